@@ -31,7 +31,9 @@
 #ifndef FONTS_H
 #define	FONTS_H
 
+#ifndef OLED_SPI_HOST
 #include <xc.h> // include processor files - each processor file is guarded.  
+#endif
 
 #ifdef	__cplusplus
 extern "C" {
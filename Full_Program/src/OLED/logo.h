@@ -19,165 +19,238 @@
  * TERMS. 
  */
 
-/* 
- * File:   
- * Author: 
- * Comments:
- * Revision history: 
- */
+/* Generated by tools/png2rle.py from logo.png, do not edit */
 
-// This is a guard condition so that contents of this file are not included
-// more than once.  
 #ifndef LOGO_H
 #define	LOGO_H
 
-#include <xc.h> // include processor files - each processor file is guarded.  
-
-#ifdef	__cplusplus
-extern "C" {
-#endif /* __cplusplus */
+#include <stdint.h>
 
 /*
- *  OLED display image 
- *  96 x 40 
- */ 
-#include <xc.h>
-
-const uint8_t curiosity_logo[]={ 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0x80, 0x70, 0xf0, 0xf0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x07, 0x03, 0x07, 0x1f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x0f, 0x07, 0x07, 0x0f, 0x3f, 0x7f, 0xfe, 0xfc, 0xf0, 
-0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0x3f, 0x1f, 0x07, 0x0f, 0x1f, 0x7f, 0xfe, 0xf8, 0xf0, 0xc0, 0x80, 0x00, 0x00, 
-0x00, 0x03, 0x07, 0x1f, 0x3f, 0xff, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 
-0x3f, 0x7f, 0xff, 0xfc, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x01, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 
-0xf0, 0xc0, 0x80, 0xc0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xe0, 0xc0, 0x00, 
-0x00, 0x00, 0x01, 0x03, 0x03, 0xf8, 0xfc, 0x06, 0x02, 0x02, 0x02, 0x02, 0x06, 0x00, 0xf8, 0xf8, 
-0x00, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xf8, 0xf8, 0x10, 0x18, 0x18, 0x00, 0xfb, 0xfb, 0x00, 
-0xe0, 0xf0, 0x18, 0x08, 0x08, 0x18, 0xf0, 0xe0, 0x00, 0x30, 0x78, 0x68, 0xc8, 0xc8, 0x98, 0x00, 
-0xfb, 0xfb, 0x00, 0x08, 0xfe, 0xfe, 0x08, 0x08, 0x08, 0x08, 0x78, 0xf0, 0x80, 0x80, 0xf0, 0x78, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x1f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x0f, 0x07, 0x07, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x03, 
-0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 
-0x00, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 
-0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x11, 0x1f, 0x0f, 0x01, 0x00, 
-};
-
-const uint8_t curiosity_logo_color[]={ 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x76, 0xc5, 0x34, 0xcd, 0x14, 0xcd, 0xd3, 0xd4, 0x51, 0xdc, 0x50, 0xe4, 0x50, 0xe4, 0x50, 0xe4, 0x50, 0xe4, 0x72, 0xd4, 0x14, 0xcd, 0x34, 0xcd, 0x55, 0xc5, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xf3, 0xcc, 0x51, 0xdc, 0xae, 0xe3, 0xcb, 0xea, 0x6a, 0xea, 0x4a, 0xea, 0x29, 0xea, 0x29, 0xea, 0x09, 0xea, 0xc8, 0xe9, 0xc8, 0xe9, 0xc8, 0xe9, 0xc8, 0xe9, 0xc8, 0xe9, 0xc8, 0xe9, 0x09, 0xea, 0x29, 0xea, 0x29, 0xea, 0x4a, 0xea, 0xcb, 0xea, 0x8d, 0xe3, 0x30, 0xe4, 0xd2, 0xd4, 0x75, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xf4, 0xcc, 0x51, 0xdc, 0x8e, 0xe3, 0xec, 0xe2, 0x8b, 0xea, 0x29, 0xea, 0xe8, 0xe9, 0x67, 0xf1, 0x26, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x26, 0xf1, 0x87, 0xf1, 0xe9, 0xe9, 0x6a, 0xea, 0xec, 0xea, 0x4d, 0xe3, 0x50, 0xe4, 0x14, 0xcd, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb7, 0xbd, 0x34, 0xcd, 0x72, 0xdc, 0xcf, 0xe3, 0x2d, 0xe3, 0x8b, 0xea, 0xa8, 0xe9, 0x47, 0xf1, 0x47, 0xf1, 0x26, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x06, 0xf1, 0x26, 0xf1, 0x47, 0xf1, 0x87, 0xf1, 0x8a, 0xea, 0x2d, 0xe3, 0x10, 0xdc, 0xb2, 0xd4, 0x55, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x75, 0xad, 0x14, 0xa5, 0x14, 0xa5, 0x75, 0xad, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xf3, 0xd4, 0x51, 0xdc, 0x8e, 0xe3, 0xcb, 0xea, 0xe8, 0xe9, 0x87, 0xe9, 0x47, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x87, 0xe9, 0x29, 0xea, 0xec, 0xe2, 0xcf, 0xdb, 0x92, 0xd4, 0x55, 0xcd, 0xb7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xf3, 0x9c, 0x51, 0x8c, 0xb2, 0x94, 0xb2, 0x94, 0x71, 0x8c, 0xf3, 0x9c, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xf3, 0xd4, 0x30, 0xdc, 0x2d, 0xeb, 0x49, 0xea, 0x87, 0xe9, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x67, 0xf1, 0xa8, 0xe9, 0x8b, 0xea, 0xf0, 0xdb, 0x14, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd3, 0x9c, 0x30, 0x84, 0xcf, 0x7b, 0xcf, 0x7b, 0x31, 0x84, 0x10, 0x84, 0xef, 0x7b, 0x14, 0xa5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0x34, 0xcd, 0x51, 0xdc, 0x0c, 0xeb, 0x29, 0xea, 0x87, 0xe9, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x4a, 0xea, 0xf0, 0xdb, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xef, 0x7b, 0x92, 0x94, 0xef, 0x7b, 0xeb, 0x5a, 0xae, 0x73, 0x30, 0x84, 0x71, 0x8c, 0xcf, 0x7b, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0x55, 0xc5, 0xb3, 0xd4, 0x8e, 0xe3, 0x4a, 0xea, 0x67, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xab, 0xea, 0x14, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xad, 0xae, 0x73, 0xf3, 0x9c, 0x51, 0x8c, 0xeb, 0x5a, 0xae, 0x73, 0x30, 0x84, 0x14, 0xa5, 0xaa, 0x52, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0x14, 0xcd, 0x10, 0xdc, 0xcc, 0xea, 0xa8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xe9, 0xaf, 0xe3, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xad, 0xae, 0x73, 0xf3, 0x9c, 0x51, 0x8c, 0x4d, 0x6b, 0xef, 0x7b, 0x71, 0x8c, 0x14, 0xa5, 0xaa, 0x52, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x76, 0xc5, 0xb2, 0xd4, 0x4d, 0xe3, 0x29, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x29, 0xea, 0x72, 0xd4, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb7, 0xb5, 0xef, 0x7b, 0x51, 0x8c, 0x30, 0x84, 0x10, 0x84, 0x71, 0x8c, 0xae, 0x73, 0x71, 0x8c, 0xcf, 0x7b, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x55, 0xcd, 0x31, 0xdc, 0xec, 0xea, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xcc, 0xea, 0x75, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf3, 0x9c, 0x10, 0x84, 0xaf, 0x73, 0x71, 0x8c, 0x92, 0x94, 0x6d, 0x6b, 0xcf, 0x7b, 0x34, 0xa5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x14, 0xcd, 0xcf, 0xe3, 0x4a, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xf0, 0xdb, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xf4, 0x9c, 0x71, 0x8c, 0x72, 0x8c, 0x92, 0x94, 0x72, 0x8c, 0xf3, 0x9c, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0xd3, 0xd4, 0x6e, 0xe3, 0xa8, 0xe9, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xe9, 0xe9, 0x14, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xb5, 0x34, 0xa5, 0x34, 0xa5, 0x75, 0xad, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xc5, 0x92, 0xd4, 0x0c, 0xeb, 0xc8, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x8e, 0xe3, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0xd3, 0xd4, 0xcb, 0xea, 0x87, 0xe9, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x88, 0xe9, 0xd3, 0xd4, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0xd3, 0xd4, 0xcb, 0xea, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4d, 0xe3, 0x35, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x14, 0xcd, 0xec, 0xea, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xe9, 0x31, 0xdc, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x75, 0xc5, 0x6d, 0xe3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcc, 0xea, 0xf4, 0xcc, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x55, 0xcd, 0xef, 0xe3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x67, 0xf1, 0x88, 0xf1, 0x88, 0xf1, 0x47, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x68, 0xf1, 0x88, 0xf1, 0x67, 0xf1, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xcf, 0xdb, 0x55, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0x71, 0xdc, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x09, 0xf2, 0x6e, 0xf3, 0x52, 0xfc, 0x32, 0xfc, 0x4d, 0xf3, 0x09, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0xab, 0xf2, 0xd0, 0xfb, 0x10, 0xfc, 0x6e, 0xfb, 0x4a, 0xf2, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4a, 0xea, 0x92, 0xd4, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xf3, 0xd4, 0xcb, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x4a, 0xf2, 0x91, 0xfc, 0x99, 0xfe, 0xdf, 0xff, 0xdf, 0xff, 0xda, 0xfe, 0x91, 0xfc, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x0d, 0xf3, 0x94, 0xfd, 0x1b, 0xff, 0x7d, 0xff, 0xb9, 0xfe, 0x13, 0xfd, 0x8a, 0xf2, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x2d, 0xe3, 0x34, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x34, 0xcd, 0x8e, 0xe3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x71, 0xfc, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x4f, 0xfc, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe9, 0xf1, 0x78, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x95, 0xfd, 0x29, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x31, 0xdc, 0xb6, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0x51, 0xdc, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x0f, 0xfc, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xeb, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xb4, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x13, 0xfd, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xec, 0xe2, 0xd3, 0xd4, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf3, 0xd4, 0x6a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x68, 0xf2, 0x58, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfe, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xac, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x2b, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x8f, 0xe3, 0x75, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x54, 0xcd, 0x8e, 0xe3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xb5, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xfb, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xe8, 0xf1, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xe9, 0x30, 0xdc, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x30, 0xdc, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x0e, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0x6a, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc9, 0xf1, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xd1, 0xfc, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x0c, 0xe3, 0xf3, 0xcc, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x14, 0xd5, 0x4d, 0xe3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa9, 0xf2, 0xfb, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xfd, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x50, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xa9, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x8e, 0xe3, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x51, 0xdc, 0x09, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0x94, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x6d, 0xf3, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0x0c, 0xf3, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x94, 0xfd, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x6a, 0xea, 0x92, 0xd4, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x55, 0xcd, 0x4d, 0xe3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xae, 0xfb, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xfd, 0xab, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x6a, 0xf2, 0x54, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x2b, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x4d, 0xe3, 0x35, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x51, 0xdc, 0x4a, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x6a, 0xf2, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x71, 0xfc, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xf1, 0x51, 0xfc, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd, 0xe8, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xe9, 0xe9, 0xf0, 0xdb, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0x6e, 0xe3, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x09, 0xf2, 0x13, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x4d, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x6e, 0xf3, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x2f, 0xfc, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x8b, 0xea, 0x34, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0x13, 0xd5, 0x8b, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x88, 0xf1, 0x8d, 0xf3, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x13, 0xfd, 0x08, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x8a, 0xf2, 0x54, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xfe, 0x8b, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x88, 0xe9, 0xaf, 0xe3, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0x30, 0xe4, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x8b, 0xf2, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0xcf, 0xfb, 0x27, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0xb2, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xb1, 0xfc, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x09, 0xea, 0xf3, 0xcc, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xb6, 0xc5, 0x0d, 0xeb, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe9, 0xf1, 0xb1, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf6, 0xfd, 0x8a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x6d, 0xf3, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x6d, 0xf3, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4d, 0xe3, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0x34, 0xd5, 0x6a, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x49, 0xf2, 0x94, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xb2, 0xfc, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x91, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xfd, 0x4a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xe9, 0x92, 0xd4, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0x50, 0xe4, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x30, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x4c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x8d, 0xf3, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x30, 0xfc, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xec, 0xea, 0x34, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0x0b, 0xeb, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x29, 0xf2, 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xb6, 0xfd, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa7, 0xf1, 0xd2, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x0c, 0xf3, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcf, 0xdb, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xb6, 0xc5, 0x09, 0xea, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0x6d, 0xf3, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x50, 0xfc, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xab, 0xf2, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf3, 0xfc, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x29, 0xea, 0xd3, 0xcc, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x54, 0xd5, 0xa8, 0xe9, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x69, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xcf, 0xfb, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0xce, 0xf3, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x6e, 0xe3, 0x34, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd2, 0xe4, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x6a, 0xf2, 0xb9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x13, 0xfd, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x09, 0xf2, 0x34, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xfd, 0xab, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xe9, 0x51, 0xdc, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x0f, 0xec, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x88, 0xf1, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xef, 0xfb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x4c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x0d, 0xf3, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xb2, 0xfc, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xec, 0xe2, 0xf3, 0xcc, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x6c, 0xeb, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x4d, 0xf3, 0xce, 0xfb, 0x09, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xc8, 0xf1, 0x78, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0xfd, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x91, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x0c, 0xf3, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xe9, 0xf0, 0xdb, 0x75, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xca, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x8a, 0xf2, 0x17, 0xfe, 0xb9, 0xfe, 0xcf, 0xf3, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xad, 0xf3, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x8e, 0xf3, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x6a, 0xf2, 0x16, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xb6, 0xfd, 0x08, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x8b, 0xea, 0x72, 0xd4, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe8, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x12, 0xfd, 0x7d, 0xff, 0xdf, 0xff, 0xb6, 0xfd, 0x8b, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0x74, 0xfd, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x08, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xae, 0xfb, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xce, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x4d, 0xe3, 0x55, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4d, 0xf3, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x51, 0xfc, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcb, 0xf2, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xfc, 0x88, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x33, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x57, 0xfe, 0x4a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe9, 0xe9, 0x30, 0xdc, 0xb6, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x2c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xb2, 0xfc, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0xcb, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xaa, 0xf2, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xf1, 0xfc, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xec, 0xea, 0x14, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x67, 0xf1, 0xb0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x75, 0xfd, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x08, 0xf2, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xfd, 0xe8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x90, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x49, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xe9, 0x4e, 0xe3, 0x96, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x89, 0xf2, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x0f, 0xfc, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcd, 0xfb, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x0c, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfd, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4a, 0xea, 0x72, 0xd4, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x09, 0xf2, 0xd9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xfe, 0xea, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x66, 0xf1, 0x13, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xfe, 0xcc, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x2a, 0xf3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xf3, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xab, 0xea, 0x75, 0xc5, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xf1, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x54, 0xfd, 0x66, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x89, 0xf2, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xfc, 0xa7, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xd5, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xfe, 0xc8, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xe9, 0x8e, 0xe3, 0xd7, 0xbd, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa7, 0xf1, 0xee, 0xfb, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x8d, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x0f, 0xfc, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x6d, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x8a, 0xf2, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x70, 0xfc, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x09, 0xea, 0xd3, 0xd4, 
-  0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xeb, 0xf2, 0x17, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xfd, 0x49, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x49, 0xf2, 0x54, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x54, 0xfd, 0x6a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0xd2, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0xeb, 0xf2, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xe9, 0x2d, 0xe3, 
-  0xa7, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4a, 0xf2, 0x13, 0xfd, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xb1, 0xfc, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x2c, 0xf3, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x51, 0xfc, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x6a, 0xf2, 0x17, 0xfe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfd, 0xe9, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xc8, 0xe9, 
-  0x89, 0xf2, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0x10, 0xfc, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x6a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x91, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x0c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xef, 0xfb, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xae, 0xf3, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 
-  0x4c, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x4d, 0xf3, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x54, 0xfd, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xab, 0xf2, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xf3, 0xfc, 0xa8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe8, 0xf1, 0x34, 0xfd, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xcb, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe9, 0xe9, 
-  0xce, 0xeb, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0x6a, 0xf2, 0x34, 0xfd, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x4c, 0xf3, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xae, 0xf3, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x8d, 0xf3, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x0c, 0xf3, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x91, 0xfc, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xec, 0xea, 
-  0x70, 0xe4, 0x47, 0xf1, 0xe6, 0xf0, 0x47, 0xf1, 0x31, 0xfc, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfd, 0x88, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x09, 0xf2, 0x54, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xb6, 0xfd, 0x29, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x92, 0xfc, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x2d, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x8e, 0xe3, 
-  0x13, 0xdd, 0x87, 0xf1, 0x06, 0xf1, 0x2d, 0xf3, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x4c, 0xf3, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xab, 0xf2, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x91, 0xfc, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xab, 0xf2, 0xb5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x34, 0xfd, 0x49, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x71, 0xd4, 
-  0xb6, 0xc5, 0xc8, 0xe9, 0x29, 0xf2, 0xb6, 0xfd, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xfc, 0x88, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x70, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0xaa, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xae, 0xfb, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x30, 0xfc, 0x26, 0xf1, 0xe6, 0xf0, 0x06, 0xf1, 0xc8, 0xe9, 0x34, 0xcd, 
-  0xd7, 0xbd, 0xcb, 0xea, 0xd1, 0xfc, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xfd, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x08, 0xf2, 0x57, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x74, 0xfd, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xf1, 0x13, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0x8a, 0xf2, 0xe6, 0xf0, 0x67, 0xf1, 0xab, 0xea, 0xb6, 0xbd, 
-  0xd7, 0xbd, 0x13, 0xe5, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0xfd, 0xa8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x4c, 0xf3, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x2c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xec, 0xf2, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xf3, 0xfc, 0xa7, 0xf1, 0x09, 0xea, 0x30, 0xdc, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0x79, 0xd6, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x2c, 0xf3, 0x67, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0xb5, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0xef, 0xfb, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0xce, 0xf3, 0xcc, 0xea, 0x55, 0xcd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0x38, 0xc6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xfd, 0x67, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xea, 0xf2, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xea, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x09, 0xf2, 0xb5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x38, 0xfe, 0x30, 0xe4, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xf7, 0xbd, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0xeb, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xf2, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x48, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x6d, 0xf3, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xb6, 0xd5, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xba, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x70, 0xfc, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4a, 0xf2, 0x38, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xd2, 0xfc, 0x46, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xc8, 0xf1, 0x91, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0x38, 0xc6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xd6, 0xfd, 0x09, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x30, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x58, 0xfe, 0x29, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x4a, 0xf2, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xe7, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x1c, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x58, 0xfe, 0xeb, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe8, 0xf1, 0x75, 0xfd, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xba, 0xfe, 0x8d, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0xee, 0xf3, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x9a, 0xd6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9a, 0xd6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x91, 0xfc, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4d, 0xf3, 0x79, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x34, 0xfd, 0x87, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xc7, 0xf1, 0x37, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x38, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xbe, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x96, 0xfd, 0x28, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x91, 0xfc, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x38, 0xfe, 0xcb, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x2c, 0xf3, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xdb, 0xde, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9a, 0xd6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x38, 0xfe, 0x2c, 0xf3, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x8a, 0xf2, 0x17, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0x50, 0xfc, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xd6, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x38, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x10, 0xfc, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcf, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x13, 0xfd, 0xc7, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa9, 0xf2, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xdb, 0xde, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9a, 0xd6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x54, 0xfd, 0xc7, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe8, 0xf1, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0x8a, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xb1, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xfd, 0x69, 0xf2, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcb, 0xf2, 0x37, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0xae, 0xfb, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x18, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x79, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x38, 0xc6, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x4d, 0xf3, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0x0f, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x71, 0xfc, 0xa8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x2b, 0xf3, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xde, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x9a, 0xd6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x30, 0xfc, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x08, 0xf2, 0x53, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfd, 0x8b, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0xd2, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x59, 0xce, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0xdb, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfd, 0x8a, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x46, 0xf1, 0x2c, 0xf3, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0x8e, 0xfb, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xcb, 0xf2, 0x17, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x79, 0xce, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x38, 0xc6, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x0c, 0xf3, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0x71, 0xfc, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x10, 0xfc, 0xc8, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x30, 0xfc, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbb, 0xde, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x59, 0xce, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x0f, 0xfc, 0x88, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xe9, 0xf1, 0x51, 0xfc, 0x78, 0xfe, 0xb9, 0xfe, 0x37, 0xfe, 0x50, 0xfc, 0xc9, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x4a, 0xf2, 0x34, 0xfd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x9a, 0xd6, 0x9e, 0xf7, 0xff, 0xff, 0x13, 0xfd, 0x09, 0xf2, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xc8, 0xf1, 0x8d, 0xf3, 0xef, 0xfb, 0x2c, 0xf3, 0xc8, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x0c, 0xf3, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x59, 0xce, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0xba, 0xd6, 0xfb, 0xfe, 0x8b, 0xf2, 0x27, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x67, 0xf1, 0x88, 0xf1, 0x47, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa8, 0xf1, 0xb1, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x59, 0xce, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x95, 0xe5, 0x09, 0xf2, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xcb, 0xf2, 0x17, 0xfe, 0xdf, 0xff, 0x7e, 0xf7, 0x7a, 0xce, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xae, 0xe3, 0x09, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0xce, 0xf3, 0x1b, 0xf7, 0x9a, 0xd6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x34, 0xcd, 0x10, 0xdc, 0x29, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0xe8, 0xf1, 0x6d, 0xeb, 0xf7, 0xd5, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x75, 0xc5, 0x10, 0xdc, 0x4a, 0xea, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x87, 0xf1, 0x4d, 0xe3, 0xd3, 0xd4, 0xb6, 0xc5, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x75, 0xc5, 0x72, 0xdc, 0xab, 0xea, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x09, 0xea, 0xae, 0xe3, 0x14, 0xcd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xb6, 0xc5, 0x92, 0xd4, 0x2d, 0xe3, 0xa8, 0xe9, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x8b, 0xea, 0x10, 0xe4, 0x34, 0xcd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xbd, 0xf3, 0xd4, 0x8e, 0xe3, 0x4a, 0xea, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xa7, 0xf1, 0x0c, 0xeb, 0x71, 0xdc, 0x75, 0xcd, 0xb7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x34, 0xcd, 0x31, 0xdc, 0x0c, 0xeb, 0xe8, 0xe9, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0x6a, 0xea, 0xae, 0xe3, 0xf3, 0xcc, 0x96, 0xc5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x96, 0xc5, 0xd3, 0xd4, 0xae, 0xe3, 0x6a, 0xea, 0x67, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe8, 0xe9, 0xec, 0xea, 0x51, 0xdc, 0x55, 0xcd, 0xb6, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xc5, 0x34, 0xcd, 0x72, 0xd4, 0x2c, 0xeb, 0x29, 0xea, 0x87, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x26, 0xf1, 0xc8, 0xe9, 0x4a, 0xea, 0xaf, 0xe3, 0xd3, 0xd4, 0x75, 0xc5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xc5, 0x14, 0xcd, 0x10, 0xdc, 0x2d, 0xe3, 0x4a, 0xea, 0xa8, 0xe9, 0x27, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x67, 0xf1, 0xe9, 0xe9, 0x6a, 0xea, 0xae, 0xe3, 0x92, 0xd4, 0x55, 0xcd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x75, 0xc5, 0xd3, 0xd4, 0x10, 0xdc, 0x4d, 0xe3, 0x6a, 0xea, 0xa8, 0xe9, 0x47, 0xf1, 0x26, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x27, 0xf1, 0x87, 0xe9, 0xe9, 0xe9, 0xcb, 0xea, 0xaf, 0xe3, 0x51, 0xdc, 0x14, 0xcd, 0xb6, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x96, 0xc5, 0x14, 0xcd, 0x31, 0xdc, 0x8e, 0xe3, 0xcc, 0xea, 0x09, 0xea, 0x47, 0xf1, 0x47, 0xf1, 0x26, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x26, 0xf1, 0x47, 0xf1, 0x87, 0xf1, 0x6a, 0xea, 0x2d, 0xe3, 0xcf, 0xdb, 0x72, 0xdc, 0x34, 0xcd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x76, 0xc5, 0xd3, 0xd4, 0xef, 0xe3, 0xec, 0xe2, 0xab, 0xea, 0x09, 0xea, 0x87, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0x06, 0xf1, 0xc8, 0xe9, 0x4a, 0xea, 0xec, 0xea, 0x4d, 0xe3, 0x10, 0xe4, 0xd3, 0xd4, 0x96, 0xc5, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xc5, 0x14, 0xcd, 0x30, 0xdc, 0x8e, 0xe3, 0xcc, 0xea, 0x8b, 0xea, 0x4a, 0xea, 0x09, 0xea, 0xe8, 0xe9, 0xa8, 0xe9, 0x87, 0xf1, 0x47, 0xf1, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x47, 0xf1, 0x67, 0xf1, 0x87, 0xf1, 0xa8, 0xe9, 0xe9, 0xe9, 0x2a, 0xea, 0x6a, 0xea, 0xab, 0xea, 0xec, 0xea, 0xcf, 0xe3, 0x92, 0xd4, 0x75, 0xc5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 
-  0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x55, 0xc5, 0xf3, 0xcc, 0x71, 0xdc, 0xcf, 0xe3, 0x4d, 0xeb, 0x0b, 0xeb, 0xcb, 0xea, 0x87, 0xe9, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0xe6, 0xf0, 0x08, 0xf2, 0xeb, 0xea, 0x2c, 0xeb, 0x8d, 0xe3, 0x0f, 0xe4, 0x92, 0xdc, 0x14, 0xcd, 0x75, 0xc5, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd
+ *  OLED display image, compressed for oledc_draw_rle_image
+ *  96 x 96, 3515 bytes instead of 18432
+ */
+const uint8_t curiosity_logo_color[] = {
+    0x60, 0x60, 0xff, 0xf0, 0xe6, 0xff, 0xff, 0xbd, 0xd7, 0xbd, 0xf7, 0xf1, 0x06, 0xf1, 0x26, 0xf1,
+    0x67, 0xff, 0xdf, 0xf1, 0x47, 0xff, 0xbe, 0xf1, 0x87, 0xc5, 0x96, 0xff, 0x7d, 0xbd, 0xb6, 0xf1,
+    0xc8, 0xcd, 0x14, 0xff, 0x9d, 0xcd, 0x34, 0xf1, 0xe8, 0xea, 0x4a, 0xe9, 0xc8, 0xf1, 0xa8, 0xd4,
+    0xd3, 0xe9, 0xa8, 0xfe, 0xda, 0xf1, 0x46, 0xff, 0x5c, 0xea, 0x29, 0xea, 0x09, 0xc5, 0x75, 0xe3,
+    0x8e, 0xfe, 0x99, 0xdc, 0x51, 0xe3, 0x4d, 0xf1, 0x27, 0xf2, 0x09, 0xff, 0x1b, 0xfd, 0x13, 0xea,
+    0x6a, 0xc5, 0xb6, 0xf1, 0x88, 0xfc, 0x91, 0xfe, 0x78, 0xf2, 0x6a, 0xff, 0x3c, 0xff, 0x9e, 0xea,
+    0xcb, 0xea, 0xec, 0xe9, 0x87, 0xf2, 0x8a, 0xfe, 0xba, 0xfe, 0x58, 0xfe, 0x17, 0xf7, 0x9e, 0xc6,
+    0x18, 0xea, 0x8b, 0xe9, 0xe9, 0xd4, 0x92, 0xcd, 0x55, 0xf2, 0x4a, 0xfd, 0xb5, 0xf3, 0x0c, 0xfd,
+    0x54, 0xf3, 0x2c, 0xe3, 0x2d, 0x8c, 0x71, 0xf3, 0x4d, 0xf2, 0xab, 0xff, 0x3b, 0xfe, 0xfb, 0xf2,
+    0x08, 0xfd, 0x34, 0xf2, 0xcb, 0xd6, 0x9a, 0xe4, 0x50, 0xcc, 0xf3, 0xe3, 0xae, 0xdc, 0x10, 0x9c,
+    0xf3, 0xdc, 0x30, 0xea, 0xab, 0xea, 0xcc, 0xff, 0x1c, 0xfd, 0xf6, 0xf3, 0x6d, 0xf3, 0x8d, 0xfc,
+    0x30, 0xf3, 0x4c, 0xf1, 0xa7, 0xfe, 0x38, 0xc6, 0x38, 0xd4, 0x72, 0xc5, 0x55, 0xe2, 0xec, 0xe9,
+    0xe8, 0xa5, 0x14, 0xd4, 0xf3, 0xdb, 0xf0, 0x7b, 0xcf, 0x7b, 0xef, 0x73, 0xae, 0xdc, 0x31, 0xfd,
+    0x94, 0xfe, 0xb9, 0xff, 0xde, 0xf2, 0x29, 0xfc, 0x0f, 0xf2, 0xeb, 0xfe, 0x79, 0xf2, 0x8b, 0xfc,
+    0xb1, 0xf2, 0x49, 0xfd, 0xb6, 0xfc, 0xd2, 0xef, 0x5d, 0xde, 0xdb, 0xe3, 0xcf, 0xdb, 0xcf, 0x8c,
+    0x51, 0x84, 0x30, 0xeb, 0x0c, 0xe3, 0xaf, 0xfc, 0x10, 0xfc, 0x71, 0xf1, 0xe9, 0xfc, 0xd1, 0xfc,
+    0x50, 0xfb, 0xae, 0xfc, 0x51, 0xfd, 0xd6, 0xfc, 0xb2, 0xf3, 0xce, 0xfd, 0xf7, 0xfb, 0xef, 0xfd,
+    0x74, 0xe7, 0x1c, 0xce, 0x59, 0xc5, 0x76, 0xe4, 0x30, 0xbd, 0xb7, 0xdc, 0x72, 0xad, 0x75, 0xb5,
+    0xb6, 0x84, 0x10, 0x94, 0x92, 0xa5, 0x34, 0xe3, 0x6e, 0xdc, 0x71, 0xfe, 0x57, 0xf3, 0x2b, 0xf2,
+    0xa9, 0xfb, 0xcf, 0xfc, 0xf3, 0xf2, 0x89, 0xf2, 0xea, 0xfc, 0x70, 0xff, 0x5d, 0xf7, 0xbe, 0xe7,
+    0x3c, 0xf1, 0xc7, 0xfe, 0x37, 0xe3, 0x8d, 0xcc, 0xf4, 0xd4, 0xb2, 0x94, 0xb2, 0x5a, 0xeb, 0xad,
+    0x96, 0x52, 0xaa, 0x8c, 0x72, 0xe9, 0x88, 0xcd, 0x35, 0xe3, 0xef, 0xf3, 0x6e, 0xf3, 0x0d, 0xfd,
+    0x95, 0xfd, 0xb4, 0xf3, 0xac, 0xf1, 0xc9, 0xfd, 0x53, 0xfc, 0x2f, 0xeb, 0x0b, 0xf2, 0x69, 0xf2,
+    0xaa, 0xfd, 0x75, 0xf1, 0x66, 0xff, 0xbf, 0xfc, 0xf2, 0xf3, 0xae, 0xf3, 0x2d, 0xd6, 0xba, 0xce,
+    0x79, 0xe4, 0x10, 0xeb, 0x2c, 0xd4, 0xd2, 0xea, 0x8a, 0xeb, 0x2d, 0xea, 0x49, 0x9c, 0xd3, 0x84,
+    0x31, 0xd4, 0xb3, 0x6b, 0x4d, 0xb5, 0xb7, 0x73, 0xaf, 0x6b, 0x6d, 0x9c, 0xf4, 0xb5, 0x96, 0xe3,
+    0x6d, 0xf1, 0x68, 0xfc, 0x52, 0xfc, 0x32, 0xfb, 0xd0, 0xfb, 0x6e, 0xfc, 0x4f, 0xf2, 0x68, 0xe3,
+    0x8f, 0xcd, 0x54, 0xfb, 0xed, 0xfc, 0x0e, 0xe3, 0x0c, 0xd5, 0x14, 0xd5, 0x13, 0xeb, 0x0d, 0xd5,
+    0x34, 0xcc, 0xd3, 0xd5, 0x54, 0xe4, 0xd2, 0xec, 0x0f, 0xeb, 0x6c, 0xfb, 0xce, 0xf2, 0xca, 0xf3,
+    0xcf, 0xf3, 0xad, 0xf3, 0x8e, 0xfe, 0x16, 0xfd, 0x12, 0xfd, 0x33, 0xfc, 0xf1, 0xfc, 0xb0, 0xfc,
+    0x90, 0xe3, 0x4e, 0xfb, 0xcd, 0xfd, 0xf5, 0xfe, 0xd9, 0xf2, 0xcc, 0xf3, 0x2a, 0xfd, 0xd5, 0xfb,
+    0xee, 0xfe, 0xdb, 0xeb, 0xce, 0xe4, 0x70, 0xfc, 0x31, 0xfc, 0x92, 0xdd, 0x13, 0xd4, 0x71, 0xfe,
+    0xfa, 0x28, 0x02, 0x84, 0x89, 0x11, 0x0f, 0x16, 0x20, 0x03, 0x4a, 0x84, 0x5b, 0x0f, 0x11, 0x5c,
+    0x0d, 0x4b, 0x02, 0x86, 0x0b, 0x4b, 0x20, 0x4c, 0x2e, 0x26, 0x13, 0x01, 0x1b, 0x80, 0x1c, 0x05,
+    0x14, 0x80, 0x1c, 0x01, 0x1b, 0x85, 0x13, 0x2e, 0xa1, 0x8a, 0xc1, 0x1d, 0x42, 0x02, 0x89, 0x0b,
+    0xa2, 0x20, 0x1e, 0x5d, 0x37, 0x1b, 0x5e, 0x06, 0x05, 0x03, 0x04, 0x05, 0x00, 0x03, 0x04, 0x88,
+    0x05, 0x0a, 0x38, 0x26, 0x2f, 0x21, 0x4a, 0x0f, 0x0d, 0x3b, 0x02, 0x86, 0x8b, 0x11, 0x8c, 0x74,
+    0x40, 0x37, 0x17, 0x01, 0x08, 0x81, 0x05, 0x04, 0x10, 0x00, 0x01, 0x04, 0x87, 0x05, 0x08, 0x0a,
+    0xc2, 0x40, 0x4d, 0xa3, 0x5c, 0x0a, 0x02, 0x80, 0x8d, 0x01, 0x5f, 0x80, 0x8d, 0x28, 0x02, 0x88,
+    0x0b, 0x60, 0x20, 0x1e, 0x2e, 0x5e, 0x30, 0x08, 0x04, 0x19, 0x00, 0x87, 0x22, 0x30, 0x1b, 0x5d,
+    0x75, 0x39, 0x3a, 0x8b, 0x05, 0x02, 0x82, 0x8e, 0x4e, 0x76, 0x01, 0xa4, 0x81, 0x41, 0x4e, 0x25,
+    0x02, 0x86, 0x0b, 0x60, 0x4f, 0xc3, 0xc4, 0x30, 0x08, 0x1f, 0x00, 0x85, 0x04, 0x06, 0x17, 0x37,
+    0x61, 0x0f, 0x05, 0x02, 0x81, 0xc5, 0x77, 0x01, 0x62, 0x83, 0xc6, 0x8f, 0x63, 0x5f, 0x22, 0x02,
+    0x86, 0x0d, 0x11, 0x20, 0x78, 0x1b, 0x30, 0x05, 0x24, 0x00, 0x83, 0x08, 0x13, 0x61, 0x0d, 0x03,
+    0x02, 0x88, 0x8e, 0x63, 0x90, 0x63, 0xa5, 0x64, 0x77, 0x41, 0x62, 0x20, 0x02, 0x86, 0x0d, 0x5c,
+    0xc7, 0x1e, 0x13, 0x06, 0x04, 0x27, 0x00, 0x82, 0x08, 0x50, 0x0f, 0x03, 0x02, 0x88, 0xa6, 0x64,
+    0x4e, 0x76, 0xa5, 0x64, 0x77, 0x5f, 0xa7, 0x1f, 0x02, 0x84, 0x0b, 0x0f, 0x4d, 0x51, 0x15, 0x2b,
+    0x00, 0x82, 0x17, 0x79, 0x0b, 0x02, 0x02, 0x88, 0xa6, 0x64, 0x4e, 0x76, 0xc8, 0x63, 0x41, 0x5f,
+    0xa7, 0x1e, 0x02, 0x83, 0x89, 0xa3, 0x21, 0x1b, 0x2d, 0x00, 0x82, 0x04, 0x1b, 0x5b, 0x02, 0x02,
+    0x88, 0xc9, 0x63, 0x76, 0x77, 0x8f, 0x41, 0x64, 0x41, 0x62, 0x1d, 0x02, 0x83, 0x3a, 0x65, 0x2f,
+    0x06, 0x2f, 0x00, 0x82, 0x08, 0x51, 0x1d, 0x02, 0x02, 0x87, 0x4e, 0x8f, 0xca, 0x41, 0x90, 0xcb,
+    0x62, 0x91, 0x1c, 0x02, 0x82, 0x0f, 0x74, 0x13, 0x32, 0x00, 0x81, 0x06, 0x61, 0x02, 0x02, 0x86,
+    0x8e, 0xcc, 0x41, 0xa8, 0x90, 0xa8, 0x4e, 0x1b, 0x02, 0x83, 0x0d, 0x16, 0x92, 0x17, 0x33, 0x00,
+    0x82, 0x04, 0x38, 0x0f, 0x03, 0x02, 0x80, 0xcd, 0x01, 0x91, 0x80, 0x8d, 0x1b, 0x02, 0x84, 0x27,
+    0x39, 0x78, 0x0e, 0x04, 0x34, 0x00, 0x82, 0x04, 0x1e, 0x0b, 0x21, 0x02, 0x84, 0x0d, 0x16, 0x2e,
+    0x30, 0x04, 0x36, 0x00, 0x82, 0xa9, 0x16, 0x0d, 0x1f, 0x02, 0x83, 0x0d, 0x16, 0x2e, 0x0a, 0x39,
+    0x00, 0x81, 0x21, 0xaa, 0x1f, 0x02, 0x82, 0x0f, 0x2f, 0x05, 0x3a, 0x00, 0x82, 0x14, 0x65, 0x0b,
+    0x1d, 0x02, 0x82, 0x1d, 0xce, 0x05, 0x3c, 0x00, 0x82, 0x51, 0xa2, 0x0d, 0x1b, 0x02, 0x82, 0x3a,
+    0xab, 0x05, 0x10, 0x00, 0x81, 0x04, 0x06, 0x01, 0x28, 0x81, 0x08, 0x04, 0x1a, 0x00, 0x84, 0x22,
+    0xcf, 0x28, 0x06, 0x05, 0x06, 0x00, 0x82, 0x08, 0x75, 0x5c, 0x1a, 0x02, 0x82, 0x0b, 0x93, 0x12,
+    0x10, 0x00, 0x87, 0x05, 0x23, 0xac, 0xd0, 0xd1, 0x42, 0x23, 0x04, 0x18, 0x00, 0x86, 0x22, 0x43,
+    0xd2, 0x7a, 0xd3, 0x3b, 0x05, 0x06, 0x00, 0x82, 0x13, 0x39, 0x0b, 0x18, 0x02, 0x82, 0x0b, 0x60,
+    0x2e, 0x10, 0x00, 0x83, 0x04, 0x3b, 0x29, 0x1f, 0x01, 0x07, 0x82, 0x18, 0x29, 0x12, 0x17, 0x00,
+    0x88, 0x04, 0xad, 0x66, 0x24, 0x0c, 0x67, 0x25, 0x31, 0x05, 0x06, 0x00, 0x81, 0x40, 0x11, 0x18,
+    0x02, 0x81, 0x11, 0x1e, 0x11, 0x00, 0x82, 0x15, 0x7b, 0x44, 0x03, 0x01, 0x82, 0x0c, 0xd4, 0x19,
+    0x16, 0x00, 0x82, 0x7c, 0x2a, 0x68, 0x02, 0x01, 0x82, 0x09, 0xae, 0x69, 0x06, 0x00, 0x82, 0x06,
+    0x65, 0x27, 0x16, 0x02, 0x82, 0x0b, 0x20, 0x19, 0x10, 0x00, 0x82, 0x05, 0x6a, 0x32, 0x05, 0x01,
+    0x82, 0x09, 0x6b, 0x04, 0x14, 0x00, 0x82, 0x06, 0xaf, 0x07, 0x04, 0x01, 0x82, 0x0c, 0x25, 0x05,
+    0x06, 0x00, 0x81, 0x5d, 0x16, 0x16, 0x02, 0x81, 0x60, 0x2b, 0x11, 0x00, 0x82, 0xd5, 0x33, 0x07,
+    0x06, 0x01, 0x81, 0x94, 0x08, 0x13, 0x00, 0x81, 0x04, 0xb0, 0x07, 0x01, 0x81, 0x45, 0x95, 0x07,
+    0x00, 0x81, 0xd6, 0x1d, 0x14, 0x02, 0x81, 0xd7, 0x1e, 0x12, 0x00, 0x81, 0x3c, 0x09, 0x08, 0x01,
+    0x81, 0xd8, 0x06, 0x11, 0x00, 0x82, 0x04, 0x12, 0x10, 0x08, 0x01, 0x81, 0x6c, 0x0a, 0x06, 0x00,
+    0x81, 0x14, 0x4f, 0x14, 0x02, 0x81, 0x4f, 0x12, 0x11, 0x00, 0x81, 0xd9, 0x52, 0x09, 0x01, 0x82,
+    0x44, 0x2b, 0x04, 0x10, 0x00, 0x81, 0xb1, 0x53, 0x09, 0x01, 0x81, 0x0c, 0x7d, 0x06, 0x00, 0x82,
+    0x04, 0xda, 0x4b, 0x12, 0x02, 0x82, 0xdb, 0x21, 0x05, 0x10, 0x00, 0x82, 0x96, 0x45, 0x07, 0x0a,
+    0x01, 0x81, 0xb2, 0x0e, 0x0f, 0x00, 0x82, 0x15, 0x7e, 0x09, 0x0a, 0x01, 0x81, 0x52, 0x96, 0x06,
+    0x00, 0x82, 0x05, 0x1e, 0x0b, 0x11, 0x02, 0x81, 0x20, 0x1c, 0x10, 0x00, 0x81, 0x19, 0x66, 0x0c,
+    0x01, 0x82, 0x2c, 0x54, 0x06, 0x0d, 0x00, 0x82, 0x19, 0x3d, 0x1f, 0x0b, 0x01, 0x82, 0x09, 0x66,
+    0x19, 0x06, 0x00, 0x81, 0x26, 0x39, 0x10, 0x02, 0x82, 0x3a, 0x21, 0x05, 0x10, 0x00, 0x81, 0x7f,
+    0x1a, 0x0d, 0x01, 0x82, 0x3c, 0x43, 0x04, 0x0c, 0x00, 0x82, 0x2b, 0x3e, 0x09, 0x0c, 0x01, 0x82,
+    0x1a, 0x95, 0x05, 0x05, 0x00, 0x82, 0x06, 0x21, 0xaa, 0x0f, 0x02, 0x81, 0x20, 0x13, 0x0f, 0x00,
+    0x82, 0x22, 0x2b, 0x2a, 0x0e, 0x01, 0x82, 0x0c, 0x7b, 0x0e, 0x0b, 0x00, 0x82, 0x0e, 0x80, 0x2c,
+    0x0e, 0x01, 0x82, 0x81, 0x12, 0x04, 0x04, 0x00, 0x82, 0x04, 0x38, 0x61, 0x0e, 0x02, 0x82, 0x0b,
+    0x92, 0x06, 0x0e, 0x00, 0x83, 0x04, 0x23, 0x25, 0x07, 0x0f, 0x01, 0x82, 0x6c, 0x42, 0x05, 0x09,
+    0x00, 0x82, 0x08, 0xac, 0x2a, 0x0f, 0x01, 0x82, 0x09, 0xb3, 0x06, 0x05, 0x00, 0x82, 0x08, 0x37,
+    0x11, 0x0d, 0x02, 0x81, 0xdc, 0x37, 0x0f, 0x00, 0x82, 0x28, 0x55, 0x2c, 0x10, 0x01, 0x82, 0x09,
+    0x25, 0x46, 0x08, 0x00, 0x83, 0x04, 0x31, 0x3e, 0x09, 0x10, 0x01, 0x82, 0x2a, 0x6d, 0x04, 0x05,
+    0x00, 0x82, 0xa9, 0x79, 0x0d, 0x0c, 0x02, 0x81, 0x8a, 0x12, 0x0e, 0x00, 0x82, 0x22, 0x6d, 0x53,
+    0x12, 0x01, 0x82, 0x32, 0x97, 0x22, 0x07, 0x00, 0x82, 0x15, 0x82, 0x52, 0x11, 0x01, 0x82, 0x09,
+    0x6e, 0x0e, 0x05, 0x00, 0x82, 0x04, 0x1c, 0x4b, 0x0b, 0x02, 0x82, 0x27, 0xdd, 0x05, 0x0e, 0x00,
+    0x82, 0x7c, 0x6e, 0x09, 0x12, 0x01, 0x82, 0x68, 0x53, 0x31, 0x07, 0x00, 0x81, 0x54, 0x1f, 0x13,
+    0x01, 0x82, 0x45, 0x54, 0x19, 0x06, 0x00, 0x81, 0x21, 0x0b, 0x0a, 0x02, 0x81, 0xde, 0x26, 0x0f,
+    0x00, 0x81, 0x6f, 0x66, 0x14, 0x01, 0x82, 0x1a, 0x82, 0x0a, 0x05, 0x00, 0x82, 0x05, 0x29, 0x0c,
+    0x14, 0x01, 0x81, 0x3c, 0x3b, 0x06, 0x00, 0x82, 0x17, 0x39, 0x0d, 0x09, 0x02, 0x81, 0x4a, 0x12,
+    0x0f, 0x00, 0x82, 0x15, 0x56, 0x09, 0x14, 0x01, 0x81, 0x1f, 0x57, 0x05, 0x00, 0x82, 0x05, 0x55,
+    0x18, 0x14, 0x01, 0x82, 0x0c, 0x56, 0x0a, 0x06, 0x00, 0x81, 0x2f, 0x11, 0x09, 0x02, 0x81, 0xb4,
+    0x06, 0x0f, 0x00, 0x82, 0x04, 0x69, 0x81, 0x14, 0x01, 0x82, 0x09, 0x70, 0x12, 0x05, 0x00, 0x82,
+    0x58, 0x71, 0x0c, 0x14, 0x01, 0x82, 0x1f, 0x3d, 0x04, 0x06, 0x00, 0x81, 0x75, 0x0b, 0x07, 0x02,
+    0x82, 0x27, 0x1c, 0x05, 0x10, 0x00, 0x82, 0x19, 0x54, 0x44, 0x14, 0x01, 0x82, 0x1a, 0x7e, 0x05,
+    0x05, 0x00, 0x81, 0x43, 0x53, 0x14, 0x01, 0x82, 0x07, 0x98, 0x12, 0x06, 0x00, 0x82, 0x1b, 0xdf,
+    0x0d, 0x06, 0x02, 0x81, 0xe0, 0x17, 0x12, 0x00, 0x81, 0x15, 0x71, 0x15, 0x01, 0x81, 0x6c, 0xb5,
+    0x05, 0x00, 0x82, 0x08, 0x97, 0x2c, 0x14, 0x01, 0x82, 0x32, 0x83, 0x08, 0x05, 0x00, 0x82, 0x04,
+    0x92, 0x11, 0x06, 0x02, 0x81, 0xe1, 0x06, 0x12, 0x00, 0x82, 0x04, 0x2b, 0x67, 0x14, 0x01, 0x82,
+    0x10, 0x25, 0x0a, 0x05, 0x00, 0x82, 0x23, 0x47, 0x09, 0x13, 0x01, 0x82, 0x07, 0x84, 0x43, 0x06,
+    0x00, 0x82, 0x14, 0x20, 0x0b, 0x05, 0x02, 0x81, 0xe2, 0x05, 0x0b, 0x00, 0x82, 0x06, 0x28, 0x05,
+    0x04, 0x00, 0x82, 0x06, 0x85, 0x09, 0x14, 0x01, 0x81, 0x2c, 0x57, 0x05, 0x00, 0x82, 0x05, 0xad,
+    0x1f, 0x14, 0x01, 0x82, 0x0c, 0x82, 0x08, 0x06, 0x00, 0x81, 0x5d, 0x4b, 0x05, 0x02, 0x81, 0xe3,
+    0x04, 0x0a, 0x00, 0x84, 0x05, 0x42, 0xe4, 0x23, 0x04, 0x03, 0x00, 0x83, 0x04, 0x0e, 0x2a, 0x07,
+    0x13, 0x01, 0x82, 0x07, 0x3c, 0x06, 0x05, 0x00, 0x82, 0x15, 0x29, 0x10, 0x14, 0x01, 0x82, 0x6c,
+    0x3d, 0x04, 0x05, 0x00, 0x82, 0x17, 0x61, 0x1d, 0x04, 0x02, 0x81, 0xe5, 0x04, 0x0a, 0x00, 0x84,
+    0x31, 0x34, 0x67, 0xe6, 0x0a, 0x05, 0x00, 0x81, 0xe7, 0x52, 0x14, 0x01, 0x82, 0x10, 0xe8, 0x08,
+    0x04, 0x00, 0x82, 0x04, 0x2b, 0xe9, 0x14, 0x01, 0x82, 0x2d, 0x70, 0x46, 0x06, 0x00, 0x82, 0x37,
+    0x5b, 0x0d, 0x03, 0x02, 0x81, 0x12, 0x04, 0x09, 0x00, 0x85, 0x06, 0xea, 0x0c, 0x07, 0x70, 0x6d,
+    0x05, 0x00, 0x82, 0x0a, 0x86, 0x2d, 0x14, 0x01, 0x82, 0x33, 0x46, 0x04, 0x04, 0x00, 0x82, 0x08,
+    0x7f, 0x2c, 0x14, 0x01, 0x82, 0x1a, 0x83, 0x05, 0x05, 0x00, 0x82, 0x08, 0x21, 0x3a, 0x03, 0x02,
+    0x0b, 0x00, 0x81, 0x42, 0x2c, 0x01, 0x01, 0x82, 0x0c, 0x80, 0x0a, 0x05, 0x00, 0x81, 0x48, 0x1f,
+    0x15, 0x01, 0x81, 0xb3, 0x28, 0x05, 0x00, 0x81, 0x06, 0xeb, 0x14, 0x01, 0x82, 0x07, 0x94, 0x3b,
+    0x06, 0x00, 0x82, 0x38, 0x4f, 0x0d, 0x02, 0x02, 0x0a, 0x00, 0x81, 0x15, 0x2a, 0x03, 0x01, 0x81,
+    0x33, 0x3f, 0x06, 0x00, 0x81, 0x82, 0x2d, 0x14, 0x01, 0x81, 0x18, 0x48, 0x05, 0x00, 0x82, 0x05,
+    0xb6, 0x1a, 0x14, 0x01, 0x82, 0x2d, 0xec, 0x04, 0x06, 0x00, 0x81, 0x2f, 0x0f, 0x02, 0x02, 0x08,
+    0x00, 0x82, 0x04, 0x06, 0xed, 0x04, 0x01, 0x82, 0x07, 0xb7, 0x0e, 0x05, 0x00, 0x81, 0x46, 0x59,
+    0x15, 0x01, 0x81, 0x66, 0x12, 0x05, 0x00, 0x82, 0x22, 0xee, 0x07, 0x14, 0x01, 0x81, 0x1a, 0x6f,
+    0x06, 0x00, 0x82, 0x30, 0xef, 0x0b, 0x01, 0x02, 0x08, 0x00, 0x82, 0x05, 0x99, 0x10, 0x05, 0x01,
+    0x81, 0x24, 0x6a, 0x06, 0x00, 0x81, 0xf0, 0x18, 0x14, 0x01, 0x82, 0x09, 0x3d, 0x05, 0x05, 0x00,
+    0x81, 0x0a, 0x44, 0x15, 0x01, 0x80, 0xf1, 0x07, 0x00, 0x81, 0x13, 0x5b, 0x01, 0x02, 0x08, 0x00,
+    0x81, 0x23, 0xf2, 0x07, 0x01, 0x81, 0x2a, 0x9a, 0x05, 0x00, 0x82, 0xb8, 0x25, 0x09, 0x14, 0x01,
+    0x81, 0x2a, 0xf3, 0x06, 0x00, 0x81, 0xf4, 0xb9, 0x15, 0x01, 0x81, 0xb0, 0x04, 0x06, 0x00, 0x82,
+    0x50, 0x1d, 0x02, 0x07, 0x00, 0x81, 0x0e, 0xba, 0x08, 0x01, 0x82, 0x2d, 0x3e, 0xb8, 0x05, 0x00,
+    0x81, 0x99, 0x33, 0x15, 0x01, 0x81, 0x7d, 0x58, 0x05, 0x00, 0x82, 0x05, 0xf5, 0x07, 0x14, 0x01,
+    0x82, 0x67, 0x0e, 0x04, 0x05, 0x00, 0x82, 0x17, 0x1e, 0x02, 0x06, 0x00, 0x82, 0x58, 0xf6, 0x1a,
+    0x09, 0x01, 0x81, 0x24, 0x55, 0x05, 0x00, 0x82, 0x05, 0x6a, 0x44, 0x14, 0x01, 0x82, 0x24, 0x54,
+    0x05, 0x05, 0x00, 0x81, 0x31, 0xf7, 0x14, 0x01, 0x82, 0x07, 0x9b, 0x06, 0x05, 0x00, 0x82, 0x04,
+    0x1c, 0x16, 0x05, 0x00, 0x82, 0x04, 0x6b, 0x34, 0x0a, 0x01, 0x82, 0x07, 0x84, 0x6f, 0x05, 0x00,
+    0x82, 0x6f, 0x3e, 0x07, 0x13, 0x01, 0x82, 0x07, 0x3e, 0x2b, 0x05, 0x00, 0x82, 0x19, 0x71, 0x0c,
+    0x14, 0x01, 0x82, 0x18, 0x6b, 0x05, 0x05, 0x00, 0x83, 0x30, 0x40, 0x58, 0x04, 0x03, 0x00, 0x82,
+    0x3b, 0x25, 0x10, 0x0b, 0x01, 0x81, 0x9c, 0x6e, 0x05, 0x00, 0x82, 0x08, 0x3f, 0x1f, 0x14, 0x01,
+    0x82, 0x24, 0x80, 0x06, 0x05, 0x00, 0x82, 0x2b, 0x34, 0x09, 0x14, 0x01, 0x81, 0x47, 0x7c, 0x05,
+    0x00, 0x83, 0x04, 0x14, 0x99, 0x05, 0x02, 0x00, 0x82, 0x0a, 0x7a, 0x24, 0x0d, 0x01, 0x81, 0x32,
+    0x2b, 0x05, 0x00, 0x82, 0x15, 0x29, 0x10, 0x14, 0x01, 0x81, 0x33, 0x3d, 0x05, 0x00, 0x82, 0x05,
+    0x85, 0x18, 0x14, 0x01, 0x82, 0x44, 0xbb, 0x0a, 0x05, 0x00, 0x82, 0x04, 0x57, 0x05, 0x01, 0x00,
+    0x82, 0x05, 0x42, 0x84, 0x0e, 0x01, 0x82, 0x2d, 0x3e, 0x0a, 0x04, 0x00, 0x82, 0x04, 0x43, 0x53,
+    0x14, 0x01, 0x82, 0x10, 0x98, 0x15, 0x05, 0x00, 0x82, 0x12, 0x47, 0x2d, 0x14, 0x01, 0x82, 0x84,
+    0x48, 0x04, 0x04, 0x00, 0x82, 0x38, 0xf8, 0x05, 0x01, 0x00, 0x82, 0x2b, 0x47, 0x0c, 0x0f, 0x01,
+    0x82, 0x0c, 0x57, 0x04, 0x04, 0x00, 0x82, 0x06, 0xbb, 0x1a, 0x14, 0x01, 0x82, 0x32, 0x55, 0x04,
+    0x04, 0x00, 0x82, 0x04, 0x3d, 0x33, 0x14, 0x01, 0x82, 0x0c, 0x29, 0x0e, 0x03, 0x00, 0x87, 0x05,
+    0x2f, 0xf9, 0x08, 0x00, 0x08, 0xfa, 0x45, 0x11, 0x01, 0x82, 0x53, 0x28, 0x04, 0x03, 0x00, 0x83,
+    0x04, 0x23, 0x3e, 0x07, 0x13, 0x01, 0x82, 0x09, 0x70, 0x69, 0x05, 0x00, 0x82, 0x06, 0xfb, 0x2c,
+    0x14, 0x01, 0x82, 0x1f, 0xbc, 0x05, 0x02, 0x00, 0x86, 0x08, 0x1e, 0xfc, 0x0a, 0x04, 0xbc, 0x59,
+    0x12, 0x01, 0x82, 0x09, 0x57, 0x08, 0x04, 0x00, 0x82, 0x05, 0x43, 0x18, 0x14, 0x01, 0x82, 0x1a,
+    0x29, 0x05, 0x05, 0x00, 0x81, 0x43, 0x3c, 0x14, 0x01, 0x82, 0x68, 0x47, 0x6f, 0x02, 0x00, 0x86,
+    0x06, 0xfd, 0x27, 0x14, 0x69, 0x70, 0x10, 0x13, 0x01, 0x81, 0x7d, 0x28, 0x05, 0x00, 0x81, 0x06,
+    0x9b, 0x15, 0x01, 0x81, 0x32, 0xb6, 0x05, 0x00, 0x82, 0x06, 0x7f, 0xfe, 0x14, 0x01, 0x8a, 0x24,
+    0x56, 0x05, 0x00, 0x04, 0x14, 0x11, 0x02, 0x2e, 0x7d, 0x9c, 0x14, 0x01, 0x81, 0xaf, 0x0e, 0x05,
+    0x00, 0x82, 0x04, 0x46, 0x94, 0x14, 0x01, 0x82, 0x09, 0x86, 0x19, 0x05, 0x00, 0x82, 0x0e, 0x25,
+    0x07, 0x14, 0x01, 0x88, 0x34, 0x31, 0x00, 0x06, 0x50, 0x0d, 0x02, 0xff, 0xe5, 0x13, 0x24, 0x15,
+    0x01, 0x81, 0xff, 0xfd, 0x32, 0x15, 0x06, 0x00, 0x82, 0x04, 0x57, 0x2d, 0x14, 0x01, 0x81, 0x10,
+    0x3f, 0x05, 0x00, 0x82, 0x04, 0xff, 0xf2, 0xec, 0x33, 0x14, 0x01, 0x84, 0x0c, 0x98, 0x58, 0x1c,
+    0x4f, 0x01, 0x02, 0x81, 0xff, 0xd6, 0x79, 0x09, 0x14, 0x01, 0x82, 0x10, 0x3f, 0x06, 0x07, 0x00,
+    0x82, 0x06, 0x3c, 0x07, 0x14, 0x01, 0x81, 0x34, 0x0e, 0x05, 0x00, 0x82, 0x0a, 0x85, 0x0c, 0x14,
+    0x01, 0x83, 0x18, 0x83, 0x51, 0x3a, 0x01, 0x02, 0x81, 0x5a, 0x9d, 0x14, 0x01, 0x82, 0x3c, 0x06,
+    0x04, 0x08, 0x00, 0x81, 0x9a, 0x2c, 0x14, 0x01, 0x82, 0x07, 0x9a, 0x04, 0x05, 0x00, 0x81, 0x23,
+    0x3c, 0x14, 0x01, 0x82, 0x07, 0x59, 0x8a, 0x02, 0x02, 0x81, 0x03, 0x72, 0x13, 0x01, 0x81, 0x18,
+    0x6b, 0x0a, 0x00, 0x82, 0x08, 0xba, 0x0c, 0x13, 0x01, 0x81, 0x2c, 0xff, 0xf2, 0x48, 0x06, 0x00,
+    0x82, 0x05, 0x54, 0x18, 0x14, 0x01, 0x81, 0x10, 0xff, 0xd5, 0xb6, 0x03, 0x02, 0x81, 0xbd, 0x07,
+    0x11, 0x01, 0x82, 0x2d, 0x9b, 0x19, 0x0b, 0x00, 0x82, 0x3b, 0x59, 0x07, 0x11, 0x01, 0x82, 0x68,
+    0x71, 0x19, 0x07, 0x00, 0x82, 0x0e, 0x29, 0x09, 0x13, 0x01, 0x81, 0x35, 0x36, 0x03, 0x02, 0x81,
+    0x5a, 0x35, 0x10, 0x01, 0x82, 0x10, 0x81, 0x23, 0x0c, 0x00, 0x82, 0x05, 0x56, 0x52, 0x10, 0x01,
+    0x82, 0x09, 0x33, 0x69, 0x08, 0x00, 0x82, 0x04, 0x3b, 0x2a, 0x12, 0x01, 0x82, 0x07, 0x9e, 0x03,
+    0x03, 0x02, 0x82, 0x03, 0x87, 0x07, 0x0e, 0x01, 0x82, 0x07, 0x33, 0x6b, 0x0e, 0x00, 0x82, 0x12,
+    0xb7, 0x0c, 0x0e, 0x01, 0x82, 0x07, 0x32, 0x55, 0x0a, 0x00, 0x82, 0x22, 0xff, 0xf3, 0xee, 0x09,
+    0x11, 0x01, 0x81, 0x35, 0x49, 0x05, 0x02, 0x81, 0x49, 0x35, 0x0e, 0x01, 0x82, 0x52, 0x29, 0x05,
+    0x0f, 0x00, 0x82, 0x42, 0x6c, 0x07, 0x0d, 0x01, 0x82, 0x9c, 0x47, 0x0a, 0x0a, 0x00, 0x82, 0x04,
+    0x9f, 0xa0, 0x11, 0x01, 0x81, 0xff, 0xef, 0x3d, 0x5a, 0x05, 0x02, 0x81, 0xff, 0xbe, 0x18, 0x9e,
+    0x0d, 0x01, 0x82, 0x1a, 0xff, 0xfd, 0x96, 0xff, 0xf2, 0x28, 0x10, 0x00, 0x82, 0x06, 0x29, 0x1a,
+    0x0c, 0x01, 0x82, 0x2d, 0x59, 0x48, 0x0d, 0x00, 0x81, 0x3f, 0x1a, 0x0f, 0x01, 0x81, 0x35, 0x73,
+    0x07, 0x02, 0x81, 0x49, 0x9d, 0x0b, 0x01, 0x82, 0x07, 0x59, 0x3f, 0x12, 0x00, 0x81, 0x31, 0x34,
+    0x0c, 0x01, 0x81, 0x18, 0x7e, 0x0f, 0x00, 0x81, 0x81, 0x07, 0x0e, 0x01, 0x81, 0x72, 0x5a, 0x07,
+    0x02, 0x81, 0x36, 0x9e, 0x0b, 0x01, 0x81, 0x24, 0x7a, 0x14, 0x00, 0x81, 0x97, 0x45, 0x0a, 0x01,
+    0x82, 0x10, 0x25, 0x9f, 0x0f, 0x00, 0x81, 0x96, 0x32, 0x0d, 0x01, 0x81, 0x9d, 0x73, 0x09, 0x02,
+    0x81, 0x49, 0x35, 0x09, 0x01, 0x82, 0x07, 0x3e, 0x9f, 0x14, 0x00, 0x81, 0x12, 0x25, 0x0a, 0x01,
+    0x81, 0x34, 0x31, 0x11, 0x00, 0x81, 0x6e, 0x0c, 0x0c, 0x01, 0x81, 0x87, 0x36, 0x0a, 0x02, 0x80,
+    0x73, 0x09, 0x01, 0x81, 0xae, 0xb5, 0x16, 0x00, 0x81, 0x48, 0xa0, 0x08, 0x01, 0x81, 0x18, 0x7f,
+    0x12, 0x00, 0x82, 0x06, 0xff, 0xfe, 0x18, 0x07, 0x0a, 0x01, 0x81, 0xff, 0xef, 0x7e, 0xbe, 0x0b,
+    0x02, 0x81, 0x5a, 0x72, 0x07, 0x01, 0x82, 0x1f, 0x42, 0x05, 0x16, 0x00, 0x82, 0x19, 0x6a, 0x0c,
+    0x06, 0x01, 0x82, 0x68, 0x7b, 0x15, 0x13, 0x00, 0x81, 0x95, 0x32, 0x09, 0x01, 0x82, 0x07, 0x73,
+    0x36, 0x0b, 0x02, 0x82, 0x03, 0x49, 0x35, 0x05, 0x01, 0x82, 0x10, 0x56, 0x0e, 0x18, 0x00, 0x81,
+    0x46, 0xb2, 0x06, 0x01, 0x82, 0x86, 0x6d, 0x04, 0x13, 0x00, 0x82, 0x08, 0x71, 0x10, 0x08, 0x01,
+    0x82, 0x87, 0x88, 0x03, 0x0c, 0x02, 0x82, 0x36, 0x73, 0x07, 0x04, 0x01, 0x82, 0x86, 0x31, 0x04,
+    0x18, 0x00, 0x82, 0x19, 0x3f, 0x24, 0x04, 0x01, 0x82, 0x18, 0xff, 0xfb, 0x8e, 0x08, 0x15, 0x00,
+    0x81, 0x48, 0x34, 0x07, 0x01, 0x82, 0x35, 0xbe, 0x03, 0x0d, 0x02, 0x82, 0x03, 0x5a, 0x87, 0x03,
+    0x01, 0x82, 0x1f, 0x3d, 0x08, 0x1a, 0x00, 0x82, 0x15, 0x7b, 0x44, 0x02, 0x01, 0x82, 0x24, 0x7a,
+    0x0e, 0x16, 0x00, 0x82, 0x06, 0x56, 0x45, 0x05, 0x01, 0x83, 0xb9, 0xff, 0xde, 0xbb, 0x36, 0x03,
+    0x0e, 0x02, 0x82, 0x03, 0x88, 0x72, 0x01, 0x01, 0x82, 0x0c, 0x6a, 0x28, 0x1b, 0x00, 0x88, 0x04,
+    0x7c, 0x80, 0x2a, 0x67, 0xa0, 0x7e, 0xb1, 0x04, 0x17, 0x00, 0x82, 0x3b, 0x47, 0x09, 0x04, 0x01,
+    0x82, 0xff, 0xe6, 0xfc, 0x36, 0x03, 0x10, 0x02, 0x86, 0x03, 0x49, 0x35, 0x01, 0x25, 0x23, 0x04,
+    0x1c, 0x00, 0x86, 0x04, 0x0e, 0x55, 0x85, 0x3f, 0x0e, 0x04, 0x18, 0x00, 0x82, 0x05, 0x3d, 0x1f,
+    0x03, 0x01, 0x82, 0x72, 0x88, 0x03, 0x11, 0x02, 0x85, 0x03, 0x36, 0xbd, 0x45, 0x6d, 0x22, 0x1f,
+    0x00, 0x83, 0x06, 0x28, 0x08, 0x04, 0x1a, 0x00, 0x82, 0x15, 0x6e, 0x09, 0x01, 0x01, 0x81, 0xff,
+    0xef, 0x7d, 0x88, 0x01, 0x03, 0x12, 0x02, 0x84, 0x03, 0x36, 0xff, 0xe5, 0x95, 0x23, 0x08, 0x3e,
+    0x00, 0x86, 0x04, 0x48, 0x34, 0x07, 0xff, 0xf7, 0x7e, 0xff, 0xce, 0x7a, 0x03, 0x16, 0x02, 0x82,
+    0x0b, 0x4c, 0x1c, 0x3f, 0x00, 0x84, 0x0a, 0x83, 0xff, 0xf7, 0x1b, 0x49, 0x03, 0x18, 0x02, 0x82,
+    0x11, 0x4d, 0x1b, 0x3d, 0x00, 0x84, 0x04, 0x12, 0xff, 0xeb, 0x6d, 0xff, 0xd5, 0xf7, 0x03, 0x0c,
+    0x02, 0x0d, 0x03, 0x82, 0x1d, 0x4d, 0x13, 0x3c, 0x00, 0x83, 0x0a, 0x21, 0x16, 0x27, 0x1c, 0x03,
+    0x83, 0x1d, 0x8c, 0x50, 0x05, 0x39, 0x00, 0x83, 0x1c, 0x4c, 0x0f, 0x02, 0x1e, 0x03, 0x83, 0x27,
+    0x39, 0x40, 0x17, 0x36, 0x00, 0x83, 0x05, 0x37, 0xbf, 0x11, 0x01, 0x02, 0x1e, 0x03, 0x85, 0x02,
+    0x0d, 0x60, 0x1e, 0x13, 0x04, 0x33, 0x00, 0x84, 0x58, 0x78, 0x93, 0xff, 0xcd, 0x75, 0x8b, 0x21,
+    0x03, 0x01, 0x02, 0x83, 0x11, 0x65, 0x78, 0x5e, 0x30, 0x00, 0x85, 0x05, 0x26, 0x4c, 0x4b, 0x0b,
+    0x02, 0x24, 0x03, 0x86, 0x02, 0x0b, 0x16, 0x4c, 0x26, 0x06, 0x04, 0x2c, 0x00, 0x85, 0x5e, 0x2f,
+    0x20, 0x3a, 0x0d, 0x02, 0x26, 0x03, 0x87, 0x02, 0x27, 0x11, 0x5b, 0xc0, 0x1b, 0x0a, 0x04, 0x27,
+    0x00, 0x86, 0x05, 0x14, 0x13, 0x79, 0x16, 0x1d, 0x02, 0x2a, 0x03, 0x87, 0x02, 0x27, 0x0f, 0x4d,
+    0x40, 0x13, 0x17, 0x22, 0x22, 0x00, 0x87, 0x04, 0x06, 0x38, 0x26, 0x4c, 0x39, 0x3a, 0x02, 0x2f,
+    0x03, 0x87, 0x1d, 0x16, 0x4d, 0x21, 0x26, 0x17, 0x08, 0x05, 0x1d, 0x00, 0x87, 0x22, 0x30, 0x38,
+    0x2e, 0x79, 0x20, 0x0f, 0x0d, 0x33, 0x03, 0x85, 0x0b, 0x0f, 0x65, 0x1e, 0x51, 0x1c, 0x01, 0x08,
+    0x81, 0x05, 0x04, 0x15, 0x00, 0x89, 0x04, 0x05, 0x08, 0x0a, 0x26, 0x40, 0x75, 0x8c, 0x11, 0x02,
+    0x37, 0x03, 0x87, 0x02, 0x89, 0x16, 0xab, 0x5d, 0x50, 0x1c, 0x0a, 0x04, 0x04, 0x0b, 0x00, 0x04,
+    0x04, 0x86, 0x14, 0x13, 0x2f, 0x21, 0xbf, 0x16, 0x0b, 0x3d, 0x03, 0x8c, 0x02, 0x27, 0x0f, 0x4f,
+    0x1e, 0x51, 0x37, 0x13, 0x1c, 0x5e, 0x17, 0x0a, 0x08, 0x04, 0x00, 0x8c, 0x08, 0x06, 0x0a, 0x17,
+    0x38, 0xff, 0xea, 0x2a, 0x26, 0x50, 0x2f, 0x74, 0x39, 0x1d, 0x02, 0x46, 0x03, 0x87, 0x5c, 0x4b,
+    0x93, 0x74, 0xff, 0xeb, 0x4d, 0xb4, 0x2e, 0x30, 0x03, 0x00, 0x87, 0x46, 0xff, 0xea, 0xeb, 0xc0,
+    0xa1, 0xff, 0xe4, 0x0f, 0xff, 0xdc, 0x92, 0x0f, 0x1d, 0x25, 0x03,
 };
 
-#ifdef	__cplusplus
-}
-#endif /* __cplusplus */
-
 #endif	/* LOGO_H */
-
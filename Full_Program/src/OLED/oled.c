@@ -23,6 +23,8 @@
 
 #include "oled.h"
 #include "hal/oled_spi_hal.h"
+#include "oled_image.h"
+#include "oled_scene.h"
 #include "logo.h"
 #include "fonts.h"
 
@@ -33,57 +35,167 @@ static uint8_t SSD1351_DEFAULT_REMAP = SSD1351_RMP_INC_HOR | SSD1351_RMP_COLOR_R
                                         SSD1351_RMP_SEQ_RGB | SSD1351_RMP_SCAN_REV |
                                         SSD1351_RMP_SPLIT_ENABLE | SSD1351_COLOR_65K;
 
-static void oledc_send_byte(uint8_t temp)
+// Lines of pixels, big enough for the widest glyph or image that fits the
+// screen. Images use both in turn so one is filled while the other is sent.
+static uint8_t oledc_line[2][SSD1351_SCREEN_WIDTH * 2];
+
+// Runs of a compressed image at least this long are sent as a fill instead
+// of being copied into a line
+#define OLED_IMAGE_FILL_RUN     16
+
+#if OLED_GLYPH_CACHE_SIZE
+#define OLED_GLYPH_SLOT_BYTES   (OLED_FONT_WIDTH * OLED_FONT_HEIGHT * OLED_GLYPH_CACHE_SCALE * 2)
+#define OLED_GLYPH_SLOTS        (OLED_GLYPH_CACHE_SIZE / OLED_GLYPH_SLOT_BYTES)
+
+_Static_assert(OLED_GLYPH_SLOTS > 0, "OLED_GLYPH_CACHE_SIZE holds no glyph");
+
+// Glyphs expanded to RGB565 in display order, the least recently used slot
+// is replaced on a miss
+typedef struct {
+    char ch;
+    uint8_t sx;
+    uint8_t sy;
+    uint16_t color;
+    uint16_t bg_color;
+    uint32_t used;
+    uint8_t pixels[OLED_GLYPH_SLOT_BYTES];
+} oledc_glyph_slot;
+
+static oledc_glyph_slot oledc_glyph_cache[OLED_GLYPH_SLOTS];
+static uint32_t oledc_glyph_clock = 0;
+#endif
+static uint32_t oledc_glyph_hits = 0;
+static uint32_t oledc_glyph_misses = 0;
+
+// RAM row on the first line of the screen and RAM row drawn at y = 0. They
+// only differ while a flip draws the lines still out of sight.
+static uint8_t oledc_top = 0;
+static uint8_t oledc_origin = 0;
+
+// Second part of a window that runs past the last RAM row
+static size_t oledc_wrap_bytes = 0;
+static uint8_t oledc_wrap_cols[2];
+static uint8_t oledc_wrap_row;
+
+/* Command stream to the SSD1351
+ * A window is opened with one command phase (column, row, write RAM) and
+ * filled with one data phase, D/C only changes between the phases. The SPI
+ * plib returns once the last bit has left the shift register and the SSD1351
+ * needs 15 ns of D/C setup before the first clock edge (tAS), less than the
+ * port write and the plib call take at 48 MHz, so no delay is needed when
+ * switching phases.
+ */
+static void oledc_stream_begin(void)
 {
-    OLED_spi_byteWrite(temp);
+    OLED_cs_low();
 }
 
-static void oledc_set_dc_send_data_byte(uint8_t temp)
+static void oledc_stream_end(void)
 {
-    OLED_dc_high();
-    OLED_delay_ms(1);
-    OLED_spi_byteWrite(temp);
+    OLED_spi_wait();
     OLED_dc_low();
+    OLED_cs_high();
 }
 
-static void oledc_set_dc_send_data(uint8_t *temp, size_t len)
+static void oledc_stream_command(uint8_t cmd, uint8_t *args, size_t len)
 {
-    OLED_dc_high();
-    OLED_delay_ms(1);
-    OLED_spi_Write(temp, len);
+    // a data phase may still be going out through the DMAC
+    OLED_spi_wait();
     OLED_dc_low();
+    OLED_spi_byteWrite(cmd);
+    if(len)
+    {
+        OLED_dc_high();
+        OLED_spi_Write(args, len);
+    }
 }
 
-static void oledc_send_bulk(uint8_t *temp, size_t len)
+static void oledc_stream_command_byte(uint8_t cmd, uint8_t arg)
 {
-    // This functions sends a bulk of data through SPI
-    // If DC is set to high before calling it, it will be considered DATA information.
-    OLED_spi_Write(temp, len);
+    oledc_stream_command(cmd, &arg, 1);
 }
 
-static void oledc_set_command(void)
+static void oledc_stream_rows(uint8_t *cols, uint8_t first_row, uint8_t last_row)
 {
-    OLED_cs_low();
-    OLED_dc_low();
-    OLED_delay_ms(2); // Give enough time for the pin to go to LOW before using SPI
+    uint8_t rows[2] = {first_row, last_row};
+
+    oledc_stream_command(SSD1351_SET_COL_ADDRESS, cols, 2);
+    oledc_stream_command(SSD1351_SET_ROW_ADDRESS, rows, 2);
+    oledc_stream_command(SSD1351_WRITE_RAM, NULL, 0);
+    OLED_dc_high();
 }
 
-static void oledc_set_data(void)
+// Opens the window and leaves D/C high for the pixel data. The lines are
+// placed from oledc_origin on, a window past the last RAM row goes on at
+// row 0 in a second one, opened once the bytes of the first one are out.
+static void oledc_stream_window(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
 {
-    OLED_dc_high();
-    OLED_delay_ms(2);
+    uint8_t first_row = (SSD1351_ROW_OFF + oledc_origin + start_y) % SSD1351_RAM_ROWS;
+    uint8_t last_row = (SSD1351_ROW_OFF + oledc_origin + end_y) % SSD1351_RAM_ROWS;
+
+    oledc_wrap_cols[0] = SSD1351_COL_OFF + start_x;
+    oledc_wrap_cols[1] = SSD1351_COL_OFF + end_x;
+    oledc_wrap_bytes = 0;
+    if(last_row < first_row)
+    {
+        oledc_wrap_bytes = (size_t)(SSD1351_RAM_ROWS - first_row) * (end_x - start_x + 1) * 2;
+        oledc_wrap_row = last_row;
+        last_row = SSD1351_RAM_ROWS - 1;
+    }
+    oledc_stream_rows(oledc_wrap_cols, first_row, last_row);
 }
 
-static void oledc_clear_command(void)
+// Bytes of pixel data that can go out before the window wraps
+static size_t oledc_stream_chunk(size_t bytes)
 {
-    while (OLED_spi_is_transmitter_busy()) ; 
-    OLED_cs_high();
+    return oledc_wrap_bytes && bytes > oledc_wrap_bytes ? oledc_wrap_bytes : bytes;
 }
 
-static void oledc_clear_data(void)
-{   
-    while (OLED_spi_is_transmitter_busy()) ;
-    OLED_dc_low();
+static void oledc_stream_sent(size_t bytes)
+{
+    if(oledc_wrap_bytes)
+    {
+        oledc_wrap_bytes -= bytes;
+        if(oledc_wrap_bytes == 0)
+            oledc_stream_rows(oledc_wrap_cols, 0, oledc_wrap_row);
+    }
+}
+
+static void oledc_stream_data(uint8_t *data, size_t bytes)
+{
+    size_t n;
+
+    while(bytes)
+    {
+        n = oledc_stream_chunk(bytes);
+        OLED_spi_WriteAsync(data, n, NULL, 0);
+        oledc_stream_sent(n);
+        data += n;
+        bytes -= n;
+    }
+}
+
+static void oledc_stream_fill(uint16_t color, uint16_t pixels)
+{
+    uint16_t n;
+
+    // the DMAC sends it while the next window is prepared
+    while(pixels)
+    {
+        n = oledc_stream_chunk((size_t)pixels * 2) / 2;
+        OLED_spi_FillAsync(color, n, NULL, 0);
+        oledc_stream_sent((size_t)n * 2);
+        pixels -= n;
+    }
+}
+
+static void oledc_flip_show(uint8_t top)
+{
+    oledc_top = top % SSD1351_RAM_ROWS;
+    oledc_stream_begin();
+    oledc_stream_command_byte(SSD1351_SET_START_LINE, 
+                              (SSD1351_DEFAULT_START_LINE + oledc_top) % SSD1351_RAM_ROWS);
+    oledc_stream_end();
 }
 
 /* --------------------------------------------------------- PUBLIC FUNCTIONS */
@@ -102,25 +214,19 @@ void OLEDC_initialize( void)
     OLED_delay_ms(200);
     OLED_dc_low();
 
-    oledc_set_command();
-    oledc_send_byte(SSD1351_COMMAND_LOCK);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_OLED_LOCK);
-    oledc_send_byte(SSD1351_COMMAND_LOCK);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_CMD_LOCK);    
-    oledc_send_byte(SSD1351_SLEEP_ON);
-
-    oledc_send_byte(SSD1351_SET_REMAP);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_REMAP);    
-    oledc_send_byte(SSD1351_MUX_RATIO);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_MUX_RATIO);
-    oledc_send_byte(SSD1351_SET_START_LINE);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_START_LINE);
-    oledc_send_byte(SSD1351_SET_OFFSET);
-    oledc_set_dc_send_data_byte(SSD1351_DEFAULT_OFFSET);
-
-    oledc_send_byte(SSD1351_MODE_NORMAL);
-    oledc_send_byte(SSD1351_SLEEP_OFF);
-    oledc_clear_command();
+    oledc_stream_begin();
+    oledc_stream_command_byte(SSD1351_COMMAND_LOCK, SSD1351_DEFAULT_OLED_LOCK);
+    oledc_stream_command_byte(SSD1351_COMMAND_LOCK, SSD1351_DEFAULT_CMD_LOCK);
+    oledc_stream_command(SSD1351_SLEEP_ON, NULL, 0);
+
+    oledc_stream_command_byte(SSD1351_SET_REMAP, SSD1351_DEFAULT_REMAP);
+    oledc_stream_command_byte(SSD1351_MUX_RATIO, SSD1351_DEFAULT_MUX_RATIO);
+    oledc_stream_command_byte(SSD1351_SET_START_LINE, SSD1351_DEFAULT_START_LINE);
+    oledc_stream_command_byte(SSD1351_SET_OFFSET, SSD1351_DEFAULT_OFFSET);
+
+    oledc_stream_command(SSD1351_MODE_NORMAL, NULL, 0);
+    oledc_stream_command(SSD1351_SLEEP_OFF, NULL, 0);
+    oledc_stream_end();
 
     oledc_print_curiosity_logo();
     OLED_delay_ms(1000);
@@ -129,7 +235,7 @@ void OLEDC_initialize( void)
 
 void oledc_print_curiosity_logo(void)
 {
-    oledc_draw_image(0, 0, 95, 95, curiosity_logo_color);
+    oledc_draw_rle_image(0, 0, curiosity_logo_color);
 }
 
 void oledc_fill_screen(uint16_t color)
@@ -140,120 +246,157 @@ void oledc_fill_screen(uint16_t color)
 void oledc_draw_character(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, char ch, uint16_t color) 
 {
     const uint8_t *f = &font[(ch - ' ') * OLED_FONT_WIDTH];
-    uint8_t i_x, i_y, j_x, j_y;
-    uint8_t cols[2], rows[2], clr[2] = {0};
-
-    clr[0] |= color >> 8;
-    clr[1] |= color & 0x00FF;
+    uint8_t i_x, i_y, run, curr_char_byte;
 
+    // the background is kept, so only the lit pixels can be written: each
+    // run of lit pixels of a column gets its own window
     for (i_x = 0; i_x < OLED_FONT_WIDTH * sx; i_x += sx) 
     { // For each COLUMN of our text
-        uint8_t curr_char_byte = *f++;
-        for (i_y = 0; i_y < OLED_FONT_HEIGHT * sy; i_y += sy) 
+        curr_char_byte = *f++;
+        i_y = 0;
+        while (curr_char_byte)
         {
             if (curr_char_byte & 0x01) 
             {
-                cols[0] = SSD1351_COL_OFF + x + i_x;
-                cols[1] = SSD1351_COL_OFF + x + i_x + sx - 1;
-                rows[0] = SSD1351_ROW_OFF + y + i_y;
-                rows[1] = SSD1351_ROW_OFF + y + i_y + sy - 1;
-
-                oledc_send_byte(SSD1351_SET_COL_ADDRESS);
-                oledc_set_dc_send_data(cols, 2);
-                oledc_send_byte(SSD1351_SET_ROW_ADDRESS);
-                oledc_set_dc_send_data(rows, 2);
-                
-                oledc_send_byte(SSD1351_WRITE_RAM);
-                oledc_set_data();
-                for (j_x = x + i_x; j_x < x + i_x + sx; j_x++) 
+                for (run = 0; curr_char_byte & 0x01; run++)
                 {
-                    for (j_y = y + i_y; j_y < y + i_y + sy; j_y++)
-                    {
-                        oledc_send_bulk(clr, 2);
-                    }
+                    curr_char_byte >>= 1;
                 }
-                oledc_clear_data();
+                oledc_stream_window(x + i_x, y + i_y * sy, 
+                                    x + i_x + sx - 1, y + (i_y + run) * sy - 1);
+                oledc_stream_fill(color, (uint16_t)sx * sy * run);
+                i_y += run;
+            }
+            else
+            {
+                curr_char_byte >>= 1;
+                i_y++;
             }
-            curr_char_byte >>= 1;
         }
     }
 }
 
+#if OLED_GLYPH_CACHE_SIZE
+static uint8_t *oledc_glyph_cache_get(char ch, uint8_t sx, uint8_t sy, uint16_t color, uint16_t bg_color)
+{
+    const uint8_t *f = oledc_glyph(ch);
+    oledc_glyph_slot *slot, *victim = &oledc_glyph_cache[0];
+    uint8_t i, i_x, line, pixel, *p;
+
+    if (sx * sy > OLED_GLYPH_CACHE_SCALE)
+        return NULL;
+    oledc_glyph_clock++;
+    for (i = 0; i < OLED_GLYPH_SLOTS; i++)
+    {
+        slot = &oledc_glyph_cache[i];
+        if (slot->used && slot->ch == ch && slot->sx == sx && slot->sy == sy &&
+            slot->color == color && slot->bg_color == bg_color)
+        {
+            slot->used = oledc_glyph_clock;
+            oledc_glyph_hits++;
+            return slot->pixels;
+        }
+        if (slot->used < victim->used)
+            victim = slot;
+    }
+
+    // the window of this glyph is open, so the victim is not on the wire
+    oledc_glyph_misses++;
+    victim->ch = ch;
+    victim->sx = sx;
+    victim->sy = sy;
+    victim->color = color;
+    victim->bg_color = bg_color;
+    victim->used = oledc_glyph_clock;
+    p = victim->pixels;
+    for (line = 0; line < OLED_FONT_HEIGHT * sy; line++)
+    {
+        for (i_x = 0; i_x < OLED_FONT_WIDTH * sx; i_x++)
+        {
+            pixel = (f[i_x / sx] >> (line / sy)) & 0x01;
+            *p++ = (pixel ? color : bg_color) >> 8;
+            *p++ = (pixel ? color : bg_color) & 0x00FF;
+        }
+    }
+    return victim->pixels;
+}
+#endif
+
 void oledc_draw_character_on_bg(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, char ch, uint16_t color, uint16_t bg_color) 
 {
-    const uint8_t *f;
-    uint8_t i_x, i_y, i, curr_char_byte, line = 0;
-    uint8_t cols[2], rows[2], clr[2] = {0}, bg_clr[2] = {0};
-
-    clr[0] |= color >> 8;
-    clr[1] |= color & 0x00FF;
-    bg_clr[0] |= bg_color >> 8;
-    bg_clr[1] |= bg_color & 0x00FF;
-    cols[0] = SSD1351_COL_OFF + x;
-    cols[1] = SSD1351_COL_OFF + x + OLED_FONT_WIDTH * sx - 1;
-    rows[0] = SSD1351_ROW_OFF + y;
-    rows[1] = SSD1351_ROW_OFF + y + OLED_FONT_HEIGHT * sy - 1;
-    
-    oledc_send_byte(SSD1351_SET_COL_ADDRESS);
-    oledc_set_dc_send_data(cols, 2);
-    oledc_send_byte(SSD1351_SET_ROW_ADDRESS);
-    oledc_set_dc_send_data(rows, 2);
-    oledc_send_byte(SSD1351_WRITE_RAM);
-    oledc_set_data();
-
-    while (line < OLED_FONT_HEIGHT)
+    const uint8_t *f = &font[(ch - ' ') * OLED_FONT_WIDTH];
+    uint8_t i_x, i_y, i, line, pixel, *p;
+    uint8_t *glyph_line = oledc_line[0];
+    uint16_t width = OLED_FONT_WIDTH * sx;
+
+    if (width > SSD1351_SCREEN_WIDTH)
+        return;
+
+    // one window for the whole glyph
+    oledc_stream_window(x, y, x + width - 1, y + OLED_FONT_HEIGHT * sy - 1);
+#if OLED_GLYPH_CACHE_SIZE
+    p = oledc_glyph_cache_get(ch, sx, sy, color, bg_color);
+    if (p)
     {
-        for (i_y = 0; i_y < sy; i_y++)
+        oledc_stream_data(p, width * OLED_FONT_HEIGHT * sy * 2);
+        return;
+    }
+#endif
+    // too large for the cache: each line is built once and sent sy times
+    for (line = 0; line < OLED_FONT_HEIGHT; line++)
+    {
+        for (i_x = 0, pixel = 0; i_x < OLED_FONT_WIDTH; i_x++)
         {
-            f = &font[(ch - ' ') * OLED_FONT_WIDTH];
-            for (i_x = 0; i_x < OLED_FONT_WIDTH * sx; i_x += sx)
-            { // For each COLUMN of our text
-                curr_char_byte = *f++;
-                curr_char_byte >>= line;
-                i = sx;
-                while (i--)
-                {
-                    if (curr_char_byte & 0x01) 
-                    {
-                        oledc_send_bulk(clr, 2);
-                    }
-                    else 
-                    {
-                        oledc_send_bulk(bg_clr, 2);
-                    }
-                }
+            pixel |= (f[i_x] >> line) & 0x01;
+        }
+        if (!pixel)
+        {
+            // nothing lit on this line, i.e. a space or the line under the
+            // characters: all of it is background
+            oledc_stream_fill(bg_color, width * sy);
+            continue;
+        }
+        // the line before may still be going out
+        OLED_spi_wait();
+        p = glyph_line;
+        for (i_x = 0; i_x < OLED_FONT_WIDTH; i_x++)
+        { // For each COLUMN of our text
+            pixel = (f[i_x] >> line) & 0x01;
+            for (i = 0; i < sx; i++)
+            {
+                *p++ = (pixel ? color : bg_color) >> 8;
+                *p++ = (pixel ? color : bg_color) & 0x00FF;
             }
         }
-        line++;
+        for (i_y = 0; i_y < sy; i_y++)
+        {
+            oledc_stream_data(glyph_line, width * 2);
+        }
     }
-    oledc_clear_data();
 }
 
 void oledc_draw_string(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, char *string, uint16_t color)
 {
-    oledc_set_command();
+    oledc_stream_begin();
     while (*string) {
         oledc_draw_character(x, y, sx, sy, *string++, color);
         x += OLED_FONT_WIDTH * sx + 1;
     }
-    oledc_clear_command();
+    oledc_stream_end();
 }
 
 void oledc_draw_string_on_bg(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, char *string, uint16_t color, uint16_t bg_color)
 {
-    oledc_set_command();
+    oledc_stream_begin();
     while (*string) {
         oledc_draw_character_on_bg(x, y, sx, sy, *string++, color, bg_color);
         x += OLED_FONT_WIDTH * sx + 1;
     }
-    oledc_clear_command();
+    oledc_stream_end();
 }
 
 void oledc_draw_rectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
 {
-    uint8_t cols[2], rows[2], clr[2] = {0};
-    uint8_t x, y;
-
     start_x = start_x > 95 ? 95 : start_x;
     end_x = end_x > 95 ? 95 : end_x;
     start_y = start_y > 95 ? 95 : start_y;
@@ -261,37 +404,16 @@ void oledc_draw_rectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8
     if((end_x < start_x) || (end_y < start_y))
         return;
 
-    cols[0] = SSD1351_COL_OFF + start_x;
-    cols[1] = SSD1351_COL_OFF + end_x;
-    rows[0] = SSD1351_ROW_OFF + start_y;
-    rows[1] = SSD1351_ROW_OFF + end_y;
-    clr[0] |= color >> 8;
-    clr[1] |= color & 0x00FF;
-
-    oledc_set_command();
-    oledc_send_byte(SSD1351_SET_COL_ADDRESS);
-    oledc_set_dc_send_data(cols, 2);
-    oledc_send_byte(SSD1351_SET_ROW_ADDRESS);
-    oledc_set_dc_send_data(rows, 2);
-    oledc_send_byte(SSD1351_WRITE_RAM);
-    oledc_set_data();
-
-    for (x = start_x; x < end_x + 1; x++) 
-    {
-        for (y = start_y; y < end_y + 1; y++)
-        {
-            oledc_send_bulk(clr, 2);
-        }
-    }
-    oledc_clear_data();
-    oledc_clear_command();
+    oledc_stream_begin();
+    oledc_stream_window(start_x, start_y, end_x, end_y);
+    oledc_stream_fill(color, (uint16_t)(end_x - start_x + 1) * (end_y - start_y + 1));
+    oledc_stream_end();
 }
 
 void oledc_draw_image(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, const uint8_t *img)
 {
-    uint8_t cols[2],rows[2];
-    uint16_t pos = 0;
     uint16_t pixels_total;
+    uint8_t i, n, line = 0;
     
     start_x = start_x > 95 ? 95 : start_x;
     end_x = end_x > 95 ? 95 : end_x;
@@ -303,55 +425,176 @@ void oledc_draw_image(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t e
     
     pixels_total = (end_x - start_x + 1) * (end_y - start_y + 1);
     
-    cols[0] = SSD1351_COL_OFF + start_x;
-    cols[1] = SSD1351_COL_OFF + end_x;
-    rows[0] = SSD1351_ROW_OFF + start_y;
-    rows[1] = SSD1351_ROW_OFF + end_y;
+    oledc_stream_begin();
+    oledc_stream_window(start_x, start_y, end_x, end_y);
     
-    oledc_set_command();
-    oledc_send_byte(SSD1351_SET_COL_ADDRESS);
-    oledc_set_dc_send_data(cols, 2);
-    oledc_send_byte(SSD1351_SET_ROW_ADDRESS);
-    oledc_set_dc_send_data(rows, 2);
-    oledc_send_byte(SSD1351_WRITE_RAM);
-    oledc_set_data();
-    
-    while(pixels_total--)
+    // the image is stored low byte first, the display takes high byte first.
+    // A line is swapped while the previous one is sent by the DMAC.
+    while(pixels_total)
     {
-        oledc_send_byte(img[pos + 1]);
-        oledc_send_byte(img[pos]);
-        pos += 2;
+        n = pixels_total > SSD1351_SCREEN_WIDTH ? SSD1351_SCREEN_WIDTH : pixels_total;
+        OLED_spi_wait_pending(1);
+        for (i = 0; i < n; i++)
+        {
+            oledc_line[line][2 * i] = img[1];
+            oledc_line[line][2 * i + 1] = img[0];
+            img += 2;
+        }
+        oledc_stream_data(oledc_line[line], n * 2);
+        line ^= 1;
+        pixels_total -= n;
     }
-    oledc_clear_data();
-    oledc_clear_command();
+    oledc_stream_end();
+}
+
+void oledc_draw_rle_image(uint8_t x, uint8_t y, const uint8_t *image)
+{
+    oledc_image_decoder decoder;
+    uint16_t color, count = 0;
+    uint8_t end_x, end_y, visible, row, i, n, k, line = 0;
+
+    if(x > 95 || y > 95 || !oledc_image_open(&decoder, image))
+        return;
+    end_x = x + oledc_image_width(image) - 1 > 95 ? 95 : x + oledc_image_width(image) - 1;
+    end_y = y + oledc_image_height(image) - 1 > 95 ? 95 : y + oledc_image_height(image) - 1;
+    visible = end_x - x + 1;
+
+    oledc_stream_begin();
+    oledc_stream_window(x, y, end_x, end_y);
+    for(row = y; row <= end_y; row++)
+    {
+        for(i = 0; i < visible; i += n)
+        {
+            n = oledc_image_next_run(&decoder, &color, visible - i);
+            if(n >= OLED_IMAGE_FILL_RUN)
+            {
+                // the pixels gathered before the run go out first
+                if(count)
+                {
+                    oledc_stream_data(oledc_line[line], count * 2);
+                    line ^= 1;
+                    count = 0;
+                }
+                oledc_stream_fill(color, n);
+                continue;
+            }
+            for(k = 0; k < n; k++)
+            {
+                // the line sent before the last transfer must be out before
+                // it is filled again
+                if(count == 0)
+                    OLED_spi_wait_pending(1);
+                oledc_line[line][2 * count] = color >> 8;
+                oledc_line[line][2 * count + 1] = color & 0x00FF;
+                if(++count == SSD1351_SCREEN_WIDTH)
+                {
+                    oledc_stream_data(oledc_line[line], count * 2);
+                    line ^= 1;
+                    count = 0;
+                }
+            }
+        }
+        // the part of the line right of the screen
+        oledc_image_skip(&decoder, oledc_image_width(image) - visible);
+    }
+    if(count)
+        oledc_stream_data(oledc_line[line], count * 2);
+    oledc_stream_end();
+}
+
+void oledc_flip_scroll(uint8_t lines, OLED_DRAW_LINES draw)
+{
+    if(lines == 0 || lines > SSD1351_FLIP_LINES)
+        return;
+    // the new lines go to the RAM rows below the screen
+    oledc_origin = (oledc_top + lines) % SSD1351_RAM_ROWS;
+    draw(SSD1351_SCREEN_HEIGHT - lines, SSD1351_SCREEN_HEIGHT - 1);
+    oledc_flip_show(oledc_origin);
+}
+
+void oledc_flip_screen(OLED_DRAW_LINES draw)
+{
+    uint8_t first;
+
+    // the whole new screen is placed below the old one, each band comes
+    // into sight with its own flip
+    oledc_origin = (oledc_top + SSD1351_SCREEN_HEIGHT) % SSD1351_RAM_ROWS;
+    for(first = 0; first < SSD1351_SCREEN_HEIGHT; first += SSD1351_FLIP_LINES)
+    {
+        draw(first, first + SSD1351_FLIP_LINES - 1);
+        oledc_flip_show(oledc_top + SSD1351_FLIP_LINES);
+    }
+}
+
+void oledc_write_window(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t *pixels)
+{
+    oledc_write_window_async(start_x, start_y, end_x, end_y, pixels);
+    oledc_wait();
+}
+
+void oledc_write_window_async(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t *pixels)
+{
+    oledc_stream_begin();
+    oledc_stream_window(start_x, start_y, end_x, end_y);
+    oledc_stream_data(pixels, (size_t)(end_x - start_x + 1) * (end_y - start_y + 1) * 2);
+}
+
+void oledc_wait(void)
+{
+    oledc_stream_end();
+}
+
+const uint8_t *oledc_glyph(char ch)
+{
+    return &font[(ch - ' ') * OLED_FONT_WIDTH];
+}
+
+void oledc_glyph_cache_stats(uint32_t *hits, uint32_t *misses, bool reset)
+{
+    *hits = oledc_glyph_hits;
+    *misses = oledc_glyph_misses;
+    if (reset)
+    {
+        oledc_glyph_hits = 0;
+        oledc_glyph_misses = 0;
+    }
+}
+
+// The warning and message screens are built in the scene, which replaces
+// any scene of the application
+static void oledc_notice_scene(char *title, uint16_t title_color, uint16_t banner_color,
+                               char *msg_line1, char *msg_line2, char *msg_line3)
+{
+    oledc_scene_clear(GRAY);
+    oledc_scene_rectangle(0, 0, 95, 32, banner_color);
+    oledc_scene_string(10, 5, 2, 3, title, title_color);
+    oledc_scene_string(5, 45, 1, 1, msg_line1, BLACK);
+    oledc_scene_string(5, 60, 1, 1, msg_line2, BLACK);
+    oledc_scene_string(5, 75, 1, 1, msg_line3, BLACK);
 }
 
 void oledc_show_warning(char *msg_line1, char *msg_line2, char *msg_line3)
 {
-    oledc_draw_rectangle(0, 0, 95, 32, RED);
-    oledc_draw_rectangle(0, 33, 95, 95, GRAY);
-    oledc_draw_string_on_bg(10, 5, 2, 3, "WARNING", YELLOW, RED);
-    oledc_draw_string_on_bg(5, 45, 1, 1, msg_line1, BLACK, GRAY);
-    oledc_draw_string_on_bg(5, 60, 1, 1, msg_line2, BLACK, GRAY);
-    oledc_draw_string_on_bg(5, 75, 1, 1, msg_line3, BLACK, GRAY);
+    // the screen comes in with flips, but the flashes redraw the banner in
+    // rows on display: a flip moves the whole picture, so the body would have
+    // to be in the RAM twice to keep still. The strips go out with their text
+    // already on them, yet a flash can still tear while the panel scans it.
+    oledc_notice_scene("WARNING", YELLOW, RED, msg_line1, msg_line2, msg_line3);
+    oledc_flip_screen(oledc_scene_render_lines);
     OLED_delay_ms(500); // do some flashing to attract attention
-    oledc_draw_rectangle(0, 0, 95, 32, YELLOW);
-    oledc_draw_string_on_bg(10, 5, 2, 3, "WARNING", RED, YELLOW);
+    oledc_notice_scene("WARNING", RED, YELLOW, msg_line1, msg_line2, msg_line3);
+    oledc_scene_render_lines(0, 32);
     OLED_delay_ms(500);
-    oledc_draw_rectangle(0, 0, 95, 32, RED);
-    oledc_draw_string_on_bg(10, 5, 2, 3, "WARNING", YELLOW, RED);
+    oledc_notice_scene("WARNING", YELLOW, RED, msg_line1, msg_line2, msg_line3);
+    oledc_scene_render_lines(0, 32);
     OLED_delay_ms(250);
     oledc_warning_flag = true;
 }
 
 void oledc_show_message(char *msg_line1, char *msg_line2, char *msg_line3)
 {
-    oledc_draw_rectangle(0, 0, 95, 32, GRAY);
-    oledc_draw_rectangle(0, 33, 95, 95, GRAY);  
-    oledc_draw_string_on_bg(10, 5, 2, 3, "MESSAGE", BLUE, GRAY);
-    oledc_draw_string_on_bg(5, 45, 1, 1, msg_line1, BLACK, GRAY);
-    oledc_draw_string_on_bg(5, 60, 1, 1, msg_line2, BLACK, GRAY);
-    oledc_draw_string_on_bg(5, 75, 1, 1, msg_line3, BLACK, GRAY);
+    oledc_notice_scene("MESSAGE", BLUE, GRAY, msg_line1, msg_line2, msg_line3);
+    oledc_flip_screen(oledc_scene_render_lines);
     OLED_delay_ms(250);
     oledc_message_flag = true;
 }
@@ -24,7 +24,13 @@
 #ifndef OLED_H
 #define	OLED_H
 
+#ifdef OLED_SPI_HOST
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#else
 #include "definitions.h"
+#endif
 
 // OLED REMAMP SET
 #define SSD1351_RMP_INC_HOR         0x00
@@ -61,6 +67,8 @@
 // Device Properties
 #define SSD1351_SCREEN_WIDTH       96
 #define SSD1351_SCREEN_HEIGHT      96
+#define SSD1351_RAM_ROWS           128
+#define SSD1351_FLIP_LINES         (SSD1351_RAM_ROWS - SSD1351_SCREEN_HEIGHT) // rows out of sight
 #define SSD1351_ROW_OFF            0x00
 #define SSD1351_COL_OFF            0x10  //collumn offset due to OLED display having only 96 visible pixels.
 
@@ -74,6 +82,19 @@
 #define OLED_FONT_WIDTH   0x5
 #define OLED_FONT_HEIGHT  0x8
 
+// RAM for expanded glyphs of oledc_draw_string_on_bg, 0 removes the cache.
+// Each slot holds one glyph of up to OLED_GLYPH_CACHE_SCALE times the font
+// size (sx * sy), larger glyphs are drawn without the cache. A slot takes
+// 5 * 8 * OLED_GLYPH_CACHE_SCALE * 2 bytes of pixels and 12 of header. The
+// default holds 12 glyphs: the widgets of the sensor screen only redraw the
+// digits that change, so 0-9 and two more fit.
+#ifndef OLED_GLYPH_CACHE_SIZE
+#define OLED_GLYPH_CACHE_SIZE   1920
+#endif
+#ifndef OLED_GLYPH_CACHE_SCALE
+#define OLED_GLYPH_CACHE_SCALE  2
+#endif
+
 #define RED     0xe962
 #define GREEN   0x1762
 #define BLUE    0x10dd
@@ -86,6 +107,9 @@
 extern "C" {
 #endif /* __cplusplus */   
 
+// Draws the lines start_y to end_y of a screen, see oledc_flip_screen
+typedef void (*OLED_DRAW_LINES)(uint8_t start_y, uint8_t end_y);
+
 /*!
  *  @brief This API is the device initialization.
  */
@@ -96,6 +120,9 @@ void OLEDC_initialize(void);
  */
 void oledc_print_curiosity_logo(void);
 
+// 96 x 96 logo shown by oledc_print_curiosity_logo, see oled_image.h
+extern const uint8_t curiosity_logo_color[];
+
 /*!
  *  @brief This API fills the screen with the selected color
  *
@@ -178,9 +205,103 @@ void oledc_draw_rectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8
  */
 void oledc_draw_image(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, const uint8_t *img);
 
+/*!
+ *  @brief This API draws a compressed image, see oled_image.h for the
+ *  format. The parts off the screen are cut. Long runs of one color are sent
+ *  as fills, the other pixels in bursts of up to a line.
+ *
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] *image : Pointer towards the compressed image
+ */
+void oledc_draw_rle_image(uint8_t x, uint8_t y, const uint8_t *image);
+
+/*
+ *  Flips
+ *  The SSD1351 has 128 rows of RAM and the panel shows 96 of them, from the
+ *  start line on. The 32 rows out of sight take new lines while the old
+ *  picture stays on, and one start line command brings them into sight.
+ *  Moving the start line moves the whole picture up, so the 32 rows are not
+ *  enough to swap a full screen at once: a flip either scrolls the screen up
+ *  to 32 lines, or replaces it in three bands of 32 lines that slide in from
+ *  the bottom. Nothing drawn by the flip is seen before it is complete.
+ *
+ *  The draw callback gets lines of the new screen and must only draw inside
+ *  them, e.g. with oledc_scene_render_lines: the other lines of the new
+ *  screen share their RAM rows with the picture on display.
+ */
+
+/*!
+ *  @brief This API scrolls the screen up by up to 32 lines. draw is called
+ *  first for the lines that come in at the bottom.
+ *
+ *  @param[in] lines : Lines to scroll, 1 to SSD1351_FLIP_LINES
+ *  @param[in] draw : Draws the lines 96 - lines to 95 of the new screen
+ */
+void oledc_flip_scroll(uint8_t lines, OLED_DRAW_LINES draw);
+
+/*!
+ *  @brief This API replaces the screen. draw is called for the lines 0-31,
+ *  32-63 and 64-95 of the new screen, each band is drawn out of sight and
+ *  slides in from the bottom when it is complete.
+ *
+ *  @param[in] draw : Draws the lines it is given of the new screen
+ */
+void oledc_flip_screen(OLED_DRAW_LINES draw);
+
+/*!
+ *  @brief This API writes a block of pixels in one SPI transfer.
+ *  The pixels are RGB565 in display order: high byte first, left to right
+ *  and top to bottom. No clipping is done.
+ *
+ *  @param[in] start_x : Start X coordinate
+ *  @param[in] start_y : Start Y coordinate
+ *  @param[in] end_x : End X coordinate
+ *  @param[in] end_y : End Y coordinate
+ *  @param[in] *pixels : Pointer towards the pixels
+ */
+void oledc_write_window(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t *pixels);
+
+/*!
+ *  @brief This API starts writing a block of pixels and returns while they
+ *  are sent. The pixels must not change until the next oledc_* call or
+ *  oledc_wait, which wait for the transfer before using the display.
+ *
+ *  @param[in] start_x : Start X coordinate
+ *  @param[in] start_y : Start Y coordinate
+ *  @param[in] end_x : End X coordinate
+ *  @param[in] end_y : End Y coordinate
+ *  @param[in] *pixels : Pointer towards the pixels
+ */
+void oledc_write_window_async(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t *pixels);
+
+/*!
+ *  @brief This API waits for the pixels still being sent and deselects the
+ *  display.
+ */
+void oledc_wait(void);
+
+/*!
+ *  @brief This API returns the font columns of a character.
+ *  OLED_FONT_WIDTH bytes, bit 0 of each byte is the top pixel.
+ *
+ *  @param[in] ch : Character
+ */
+const uint8_t *oledc_glyph(char ch);
+
+/*!
+ *  @brief This API returns the glyph cache counters since the last reset.
+ *
+ *  @param[out] *hits : Glyphs sent from the cache
+ *  @param[out] *misses : Glyphs expanded into the cache
+ *  @param[in] reset : Restart the counters
+ */
+void oledc_glyph_cache_stats(uint32_t *hits, uint32_t *misses, bool reset);
+
 /*!
  *  @brief This API shows a warning screen and a message.
- *  Maximum 14 characters on a line. Use empty strings for lines that contains
+ *  The screen comes in with oledc_flip_screen, the banner then flashes in
+ *  place and is not tear-free. Maximum 14 characters on a line. Use empty strings for lines that contains
  *  no message.
  *
  *  @param[in] *msg_line1 : Pointer towards string that will be displayed on
@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include "oled_chart.h"
+
+// Lines of the chart while it is redrawn, or the two columns of a sample
+static uint8_t oledc_chart_buffer[2][SSD1351_SCREEN_WIDTH * 2];
+
+static uint8_t oledc_chart_line(const oledc_chart *chart, uint16_t value)
+{
+    uint32_t span = chart->max - chart->min;
+
+    if(value <= chart->min)
+        return chart->height - 1;
+    if(value >= chart->max)
+        return 0;
+    return chart->height - 1 - (uint32_t)(value - chart->min) * (chart->height - 1) / span;
+}
+
+// Lines covered by the sample of a column: from its value to the one of the
+// column before, so the samples are joined
+static bool oledc_chart_segment(const oledc_chart *chart, uint8_t column, uint8_t *top, uint8_t *bottom)
+{
+    uint8_t before = column ? column - 1 : chart->width - 1;
+    uint8_t a, b;
+
+    if(column >= chart->count || column == chart->next)
+        return false;
+    a = b = oledc_chart_line(chart, chart->samples[column]);
+    // the sample under the sweep gap is kept until it is replaced, as the
+    // column after the gap was joined to it
+    if(before < chart->count)
+        b = oledc_chart_line(chart, chart->samples[before]);
+    *top = a < b ? a : b;
+    *bottom = a < b ? b : a;
+    return true;
+}
+
+static void oledc_chart_pixel(uint8_t *p, uint16_t color)
+{
+    p[0] = color >> 8;
+    p[1] = color & 0x00FF;
+}
+
+// Scale from the samples on the chart, with a quarter of their span (at
+// least min_span) above and below. Returns false when the current one still
+// fits.
+static bool oledc_chart_scale(oledc_chart *chart)
+{
+    uint16_t lo = UINT16_MAX, hi = 0, pad;
+    uint32_t span;
+    uint8_t i;
+
+    for(i = 0; i < chart->count; i++)
+    {
+        if(i == chart->next)
+            continue;
+        lo = chart->samples[i] < lo ? chart->samples[i] : lo;
+        hi = chart->samples[i] > hi ? chart->samples[i] : hi;
+    }
+    span = hi - lo < chart->min_span ? chart->min_span : hi - lo;
+    if(chart->max > chart->min && lo >= chart->min && hi <= chart->max &&
+       span * 3 >= (uint32_t)(chart->max - chart->min))
+        return false;
+    pad = (span - (hi - lo)) / 2 + span / 4 + 1;
+    chart->min = lo > pad ? lo - pad : 0;
+    chart->max = (uint32_t)hi + pad > UINT16_MAX ? UINT16_MAX : hi + pad;
+    return true;
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+void oledc_chart_init(oledc_chart *chart, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                      uint16_t min_span, uint16_t color, uint16_t bg_color)
+{
+    // the chart must fit on the screen, with the sweep gap
+    width = x + width > SSD1351_SCREEN_WIDTH ? SSD1351_SCREEN_WIDTH - x : width;
+    height = y + height > SSD1351_SCREEN_HEIGHT ? SSD1351_SCREEN_HEIGHT - y : height;
+    chart->x = x;
+    chart->y = y;
+    chart->width = width < 2 ? 2 : width;
+    chart->height = height < 2 ? 2 : height;
+    chart->next = 0;
+    chart->count = 0;
+    chart->color = color;
+    chart->bg_color = bg_color;
+    chart->min = 0;
+    chart->max = 0;
+    chart->min_span = min_span;
+    oledc_chart_redraw(chart);
+}
+
+bool oledc_chart_add(oledc_chart *chart, uint16_t value)
+{
+    uint8_t column = chart->next, gap, line, top, bottom, *p;
+
+    chart->samples[column] = value;
+    if(chart->count <= column)
+        chart->count = column + 1;
+    chart->next = gap = column + 1 < chart->width ? column + 1 : 0;
+    if(oledc_chart_scale(chart))
+    {
+        oledc_chart_redraw(chart);
+        return true;
+    }
+
+    // the sample and the gap after it, in one window when they are side by
+    // side, the gap is sent on its own at the end of the sweep
+    oledc_chart_segment(chart, column, &top, &bottom);
+    p = oledc_chart_buffer[0];
+    for(line = 0; line < chart->height; line++)
+    {
+        oledc_chart_pixel(p, line >= top && line <= bottom ? chart->color : chart->bg_color);
+        p += 2;
+        if(gap)
+        {
+            oledc_chart_pixel(p, chart->bg_color);
+            p += 2;
+        }
+    }
+    oledc_write_window(chart->x + column, chart->y, chart->x + column + (gap ? 1 : 0),
+                       chart->y + chart->height - 1, oledc_chart_buffer[0]);
+    if(gap == 0)
+    {
+        oledc_draw_rectangle(chart->x, chart->y, chart->x, chart->y + chart->height - 1, chart->bg_color);
+    }
+    return false;
+}
+
+void oledc_chart_redraw(oledc_chart *chart)
+{
+    uint8_t top[SSD1351_SCREEN_WIDTH], bottom[SSD1351_SCREEN_WIDTH];
+    uint8_t column, line, buffer = 0, *p;
+
+    for(column = 0; column < chart->width; column++)
+    {
+        if(!oledc_chart_segment(chart, column, &top[column], &bottom[column]))
+        {
+            top[column] = UINT8_MAX;
+            bottom[column] = 0;
+        }
+    }
+    // line by line, one is built while the one before is sent
+    for(line = 0; line < chart->height; line++)
+    {
+        p = oledc_chart_buffer[buffer];
+        for(column = 0; column < chart->width; column++, p += 2)
+        {
+            oledc_chart_pixel(p, line >= top[column] && line <= bottom[column] ?
+                                 chart->color : chart->bg_color);
+        }
+        oledc_write_window_async(chart->x, chart->y + line, chart->x + chart->width - 1,
+                                 chart->y + line, oledc_chart_buffer[buffer]);
+        buffer ^= 1;
+    }
+    oledc_wait();
+}
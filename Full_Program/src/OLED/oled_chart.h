@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Trend chart for the OLED
+ *
+ *  The chart plots one sample per column as a line, sweeping from left to
+ *  right: a new sample is written over the oldest one, with a blank column
+ *  after it to mark the sweep. Only those two columns are sent, in one
+ *  window of a few hundred bytes, instead of the whole chart.
+ *
+ *  The scale follows the samples on the chart with some hysteresis: it grows
+ *  when a sample falls outside of it and shrinks only when the samples span
+ *  less than a third of it. Only a new scale redraws the whole chart.
+ */
+
+#ifndef OLED_CHART_H
+#define	OLED_CHART_H
+
+#include "oled.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;              // columns, one sample each
+    uint8_t height;
+    uint8_t next;               // column of the next sample
+    uint8_t count;              // columns with a sample
+    uint16_t color;
+    uint16_t bg_color;
+    uint16_t min;               // value on the bottom line
+    uint16_t max;               // value on the top line
+    uint16_t min_span;          // smallest max - min, so noise is not zoomed
+    uint16_t samples[SSD1351_SCREEN_WIDTH];
+} oledc_chart;
+
+/*!
+ *  @brief This API sets up a chart and clears its area.
+ *
+ *  @param[out] *chart : The chart
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] width : Columns of the chart, at least 2
+ *  @param[in] height : Lines of the chart, at least 2
+ *  @param[in] min_span : Smallest range of values shown
+ *  @param[in] color : Color of the line
+ *  @param[in] bg_color : Color of the background
+ */
+void oledc_chart_init(oledc_chart *chart, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                      uint16_t min_span, uint16_t color, uint16_t bg_color);
+
+/*!
+ *  @brief This API adds a sample after the last one.
+ *
+ *  @param[in] *chart : The chart
+ *  @param[in] value : The sample
+ *
+ *  @return true when the scale changed and the whole chart was redrawn
+ */
+bool oledc_chart_add(oledc_chart *chart, uint16_t value);
+
+/*!
+ *  @brief This API redraws the whole chart, after the display was drawn
+ *  over.
+ *
+ *  @param[in] *chart : The chart
+ */
+void oledc_chart_redraw(oledc_chart *chart);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* OLED_CHART_H */
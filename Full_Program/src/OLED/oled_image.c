@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <stddef.h>
+#include "oled_image.h"
+
+#define OLED_IMAGE_HEADER       3
+#define OLED_IMAGE_LITERAL      0x80
+
+static uint16_t oledc_image_color(oledc_image_decoder *decoder)
+{
+    const uint8_t *c = decoder->src++;
+
+    if(*c == OLED_IMAGE_COLOR_RAW)
+    {
+        decoder->src += 2;
+        c++;
+    }
+    else
+    {
+        c = &decoder->palette[*c * 2];
+    }
+    return (c[0] << 8) | c[1];
+}
+
+bool oledc_image_open(oledc_image_decoder *decoder, const uint8_t *image)
+{
+    if(image == NULL || image[0] == 0 || image[1] == 0)
+        return false;
+    decoder->palette = &image[OLED_IMAGE_HEADER];
+    decoder->src = decoder->palette + image[2] * 2;
+    decoder->left = 0;
+    return true;
+}
+
+uint8_t oledc_image_next_run(oledc_image_decoder *decoder, uint16_t *color, uint8_t max)
+{
+    uint8_t n;
+
+    if(decoder->left == 0)
+    {
+        n = *decoder->src++;
+        decoder->literal = n & OLED_IMAGE_LITERAL;
+        decoder->left = (n & ~OLED_IMAGE_LITERAL) + 1;
+        if(!decoder->literal)
+            decoder->color = oledc_image_color(decoder);
+    }
+    if(decoder->literal)
+    {
+        decoder->left--;
+        *color = oledc_image_color(decoder);
+        return 1;
+    }
+    n = decoder->left < max ? decoder->left : max;
+    decoder->left -= n;
+    *color = decoder->color;
+    return n;
+}
+
+void oledc_image_skip(oledc_image_decoder *decoder, uint16_t pixels)
+{
+    uint16_t color;
+
+    while(pixels)
+    {
+        pixels -= oledc_image_next_run(decoder, &color, pixels > UINT8_MAX ? UINT8_MAX : pixels);
+    }
+}
+
+uint8_t oledc_image_width(const uint8_t *image)
+{
+    return image[0];
+}
+
+uint8_t oledc_image_height(const uint8_t *image)
+{
+    return image[1];
+}
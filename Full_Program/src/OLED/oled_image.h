@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Compressed images for the OLED
+ *
+ *  A raw 96x96 RGB565 image takes 18 KB of flash. The images drawn with
+ *  oledc_draw_rle_image are stored with a palette and run lengths instead,
+ *  the header is generated from a PNG by tools/png2rle.py:
+ *
+ *  byte 0      width
+ *  byte 1      height
+ *  byte 2      N, colors in the palette, 0 to 255
+ *  N x 2       palette, RGB565 high byte first as the display takes it
+ *  then the pixels, line after line, as blocks of:
+ *  0x00-0x7F   op + 1 pixels of the color that follows
+ *  0x80-0xFF   op - 0x7F pixels, each followed by its color
+ *
+ *  A color is an index into the palette, or 0xFF followed by the RGB565
+ *  value, high byte first, for the colors the palette has no room for.
+ *
+ *  The decoder is a stream: it keeps its place in the data, so an image is
+ *  drawn in pieces of any size without a buffer for it.
+ */
+
+#ifndef OLED_IMAGE_H
+#define	OLED_IMAGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Palette index of a color stored in the data
+#define OLED_IMAGE_COLOR_RAW    0xFF
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    const uint8_t *src;         // next block or color
+    const uint8_t *palette;
+    uint8_t left;               // pixels left in the block
+    bool literal;               // each pixel of the block has its color
+    uint16_t color;             // color of a run
+} oledc_image_decoder;
+
+/*!
+ *  @brief This API starts the decoding of an image at its first pixel.
+ *
+ *  @param[out] *decoder : The decoder
+ *  @param[in] *image : The compressed image
+ *
+ *  @return false when the image is empty
+ */
+bool oledc_image_open(oledc_image_decoder *decoder, const uint8_t *image);
+
+/*!
+ *  @brief This API returns the next pixels of the same color.
+ *
+ *  @param[in] *decoder : The decoder
+ *  @param[out] *color : Their color, RGB565
+ *  @param[in] max : Most pixels to return, at least 1
+ *
+ *  @return The number of pixels, from 1 to max
+ */
+uint8_t oledc_image_next_run(oledc_image_decoder *decoder, uint16_t *color, uint8_t max);
+
+/*!
+ *  @brief This API skips pixels of the image.
+ *
+ *  @param[in] *decoder : The decoder
+ *  @param[in] pixels : Number of pixels to skip
+ */
+void oledc_image_skip(oledc_image_decoder *decoder, uint16_t pixels);
+
+/*!
+ *  @brief These APIs return the size of an image.
+ *
+ *  @param[in] *image : The compressed image
+ */
+uint8_t oledc_image_width(const uint8_t *image);
+uint8_t oledc_image_height(const uint8_t *image);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* OLED_IMAGE_H */
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <string.h>
+#include "oled_scene.h"
+#include "oled_image.h"
+#include "hal/oled_spi_hal.h"
+
+#define OLED_SCENE_LAST     (SSD1351_SCREEN_WIDTH - 1)
+
+typedef enum {
+    OLED_SCENE_RECTANGLE,
+    OLED_SCENE_STRING,
+    OLED_SCENE_STRING_ON_BG,
+    OLED_SCENE_IMAGE,
+    OLED_SCENE_RLE_IMAGE,
+} OLED_SCENE_TYPE;
+
+// Items keep the coordinates they were given, they are clipped when drawn
+typedef struct {
+    uint8_t type;
+    uint8_t start_x;
+    uint8_t start_y;
+    uint8_t end_x;
+    uint8_t end_y;
+    uint8_t sx;
+    uint8_t sy;
+    uint8_t length;             // characters of a string, decoder of a
+                                // compressed image
+    uint16_t color;
+    uint16_t bg_color;
+    union {
+        const uint8_t *img;
+        uint16_t text;          // offset of a string in oledc_scene_text
+    } data;
+} oledc_scene_item;
+
+static oledc_scene_item oledc_scene_items[OLED_SCENE_MAX_ITEMS];
+static uint8_t oledc_scene_count = 0;
+static char oledc_scene_text[OLED_SCENE_TEXT_SIZE];
+static uint16_t oledc_scene_text_used = 0;
+static uint16_t oledc_scene_bg = BLACK;
+
+// A compressed image is decoded once per render, line after line
+static oledc_image_decoder oledc_scene_decoders[OLED_SCENE_MAX_IMAGES];
+static uint8_t oledc_scene_images = 0;
+
+// The strips are kept in display byte order, so they go out as they are.
+// One strip is built while the other one is sent by the DMAC.
+static uint8_t oledc_strip[2][OLED_SCENE_STRIP_LINES][SSD1351_SCREEN_WIDTH * 2];
+
+static oledc_scene_item *oledc_scene_add(uint8_t type, uint8_t start_x, uint8_t start_y,
+                                          uint8_t end_x, uint8_t end_y)
+{
+    oledc_scene_item *item;
+
+    if(oledc_scene_count >= OLED_SCENE_MAX_ITEMS || end_x < start_x || end_y < start_y)
+        return NULL;
+    item = &oledc_scene_items[oledc_scene_count++];
+    item->type = type;
+    item->start_x = start_x;
+    item->start_y = start_y;
+    item->end_x = end_x;
+    item->end_y = end_y;
+    return item;
+}
+
+static bool oledc_scene_add_string(uint8_t type, uint8_t x, uint8_t y, uint8_t sx, uint8_t sy,
+                                   const char *string, uint16_t color, uint16_t bg_color)
+{
+    oledc_scene_item *item;
+    size_t length = strlen(string);
+    uint16_t width = length * (OLED_FONT_WIDTH * sx + 1) - 1;
+
+    if(length == 0 || length > UINT8_MAX || sx == 0 || sy == 0 ||
+       oledc_scene_text_used + length > OLED_SCENE_TEXT_SIZE)
+        return false;
+    // a string running off the screen is cut at the right edge
+    item = oledc_scene_add(type, x, y, x + width - 1 > UINT8_MAX ? UINT8_MAX : x + width - 1,
+                           y + OLED_FONT_HEIGHT * sy - 1 > UINT8_MAX ? UINT8_MAX : y + OLED_FONT_HEIGHT * sy - 1);
+    if(item == NULL)
+        return false;
+    item->sx = sx;
+    item->sy = sy;
+    item->length = length;
+    item->color = color;
+    item->bg_color = bg_color;
+    item->data.text = oledc_scene_text_used;
+    memcpy(&oledc_scene_text[oledc_scene_text_used], string, length);
+    oledc_scene_text_used += length;
+    return true;
+}
+
+static void oledc_scene_span(uint8_t *line, uint16_t start_x, uint16_t end_x, uint16_t color)
+{
+    if(start_x > OLED_SCENE_LAST)
+        return;
+    if(end_x > OLED_SCENE_LAST)
+        end_x = OLED_SCENE_LAST;
+    for(line += start_x * 2; start_x <= end_x; start_x++)
+    {
+        *line++ = color >> 8;
+        *line++ = color & 0x00FF;
+    }
+}
+
+static void oledc_scene_draw_string(const oledc_scene_item *item, uint8_t *line, uint8_t y)
+{
+    const char *text = &oledc_scene_text[item->data.text];
+    const uint8_t *f;
+    uint8_t row = (y - item->start_y) / item->sy;
+    uint8_t i, col;
+    uint16_t x = item->start_x;
+
+    for(i = 0; i < item->length && x <= OLED_SCENE_LAST; i++)
+    {
+        f = oledc_glyph(text[i]);
+        for(col = 0; col < OLED_FONT_WIDTH; col++, x += item->sx)
+        {
+            if((f[col] >> row) & 0x01)
+                oledc_scene_span(line, x, x + item->sx - 1, item->color);
+            else if(item->type == OLED_SCENE_STRING_ON_BG)
+                oledc_scene_span(line, x, x + item->sx - 1, item->bg_color);
+        }
+        x++;
+    }
+}
+
+static void oledc_scene_draw_image(const oledc_scene_item *item, uint8_t *line, uint8_t y)
+{
+    uint16_t width = item->end_x - item->start_x + 1;
+    uint8_t x, end_x = item->end_x > OLED_SCENE_LAST ? OLED_SCENE_LAST : item->end_x;
+    const uint8_t *src = &item->data.img[(uint32_t)(y - item->start_y) * width * 2];
+
+    if(item->start_x > OLED_SCENE_LAST)
+        return;
+    // the image is stored low byte first, the display takes high byte first
+    for(x = item->start_x, line += x * 2; x <= end_x; x++, src += 2)
+    {
+        *line++ = src[1];
+        *line++ = src[0];
+    }
+}
+
+static void oledc_scene_draw_rle_image(const oledc_scene_item *item, uint8_t *line)
+{
+    oledc_image_decoder *decoder = &oledc_scene_decoders[item->length];
+    uint16_t x = item->start_x, end_x = item->start_x + oledc_image_width(item->data.img);
+    uint16_t color;
+    uint8_t n;
+
+    // the whole line is decoded, the part right of the screen is dropped
+    for(; x < end_x; x += n)
+    {
+        n = oledc_image_next_run(decoder, &color, end_x - x > UINT8_MAX ? UINT8_MAX : end_x - x);
+        oledc_scene_span(line, x, x + n - 1, color);
+    }
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+void oledc_scene_clear(uint16_t bg_color)
+{
+    oledc_scene_count = 0;
+    oledc_scene_text_used = 0;
+    oledc_scene_images = 0;
+    oledc_scene_bg = bg_color;
+}
+
+bool oledc_scene_rectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    oledc_scene_item *item = oledc_scene_add(OLED_SCENE_RECTANGLE, start_x, start_y, end_x, end_y);
+
+    if(item == NULL)
+        return false;
+    item->color = color;
+    return true;
+}
+
+bool oledc_scene_string(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, const char *string, uint16_t color)
+{
+    return oledc_scene_add_string(OLED_SCENE_STRING, x, y, sx, sy, string, color, 0);
+}
+
+bool oledc_scene_string_on_bg(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, const char *string, uint16_t color, uint16_t bg_color)
+{
+    return oledc_scene_add_string(OLED_SCENE_STRING_ON_BG, x, y, sx, sy, string, color, bg_color);
+}
+
+bool oledc_scene_image(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, const uint8_t *img)
+{
+    oledc_scene_item *item = oledc_scene_add(OLED_SCENE_IMAGE, start_x, start_y, end_x, end_y);
+
+    if(item == NULL)
+        return false;
+    item->data.img = img;
+    return true;
+}
+
+bool oledc_scene_rle_image(uint8_t x, uint8_t y, const uint8_t *image)
+{
+    oledc_scene_item *item;
+    uint16_t end_x, end_y;
+
+    if(oledc_scene_images >= OLED_SCENE_MAX_IMAGES || image == NULL ||
+       oledc_image_width(image) == 0 || oledc_image_height(image) == 0)
+        return false;
+    end_x = x + oledc_image_width(image) - 1;
+    end_y = y + oledc_image_height(image) - 1;
+    item = oledc_scene_add(OLED_SCENE_RLE_IMAGE, x, y, end_x > UINT8_MAX ? UINT8_MAX : end_x,
+                           end_y > UINT8_MAX ? UINT8_MAX : end_y);
+    if(item == NULL)
+        return false;
+    item->data.img = image;
+    item->length = oledc_scene_images++;
+    return true;
+}
+
+void oledc_scene_render(void)
+{
+    oledc_scene_render_lines(0, OLED_SCENE_LAST);
+}
+
+void oledc_scene_render_lines(uint8_t start_y, uint8_t end_y)
+{
+    const oledc_scene_item *item;
+    uint8_t (*strip)[SSD1351_SCREEN_WIDTH * 2];
+    uint8_t first, last, y, i, buffer = 0;
+    
+    if(end_y > OLED_SCENE_LAST)
+        end_y = OLED_SCENE_LAST;
+    // the compressed images are decoded from their first line drawn
+    for(i = 0; i < oledc_scene_count; i++)
+    {
+        item = &oledc_scene_items[i];
+        if(item->type == OLED_SCENE_RLE_IMAGE)
+        {
+            oledc_image_open(&oledc_scene_decoders[item->length], item->data.img);
+            if(start_y > item->start_y)
+                oledc_image_skip(&oledc_scene_decoders[item->length], 
+                                 (uint16_t)(start_y - item->start_y) * oledc_image_width(item->data.img));
+        }
+    }
+
+    for(first = start_y; first <= end_y; first = last + 1)
+    {
+        last = end_y - first < OLED_SCENE_STRIP_LINES ? end_y : first + OLED_SCENE_STRIP_LINES - 1;
+        // the strip sent before the last one must be out before it is reused
+        OLED_spi_wait_pending(1);
+        strip = oledc_strip[buffer];
+        for(y = first; y <= last; y++)
+        {
+            oledc_scene_span(strip[y - first], 0, OLED_SCENE_LAST, oledc_scene_bg);
+        }
+        for(i = 0; i < oledc_scene_count; i++)
+        {
+            item = &oledc_scene_items[i];
+            for(y = item->start_y > first ? item->start_y : first; 
+                y <= last && y <= item->end_y; y++)
+            {
+                switch(item->type)
+                {
+                    case OLED_SCENE_RECTANGLE: 
+                        oledc_scene_span(strip[y - first], item->start_x, item->end_x, item->color); 
+                        break;
+                    case OLED_SCENE_IMAGE: 
+                        oledc_scene_draw_image(item, strip[y - first], y); 
+                        break;
+                    case OLED_SCENE_RLE_IMAGE: 
+                        oledc_scene_draw_rle_image(item, strip[y - first]); 
+                        break;
+                    default: 
+                        oledc_scene_draw_string(item, strip[y - first], y); 
+                        break;
+                }
+            }
+        }
+        oledc_write_window_async(0, first, OLED_SCENE_LAST, last, strip[0]);
+        buffer ^= 1;
+    }
+    oledc_wait();
+}
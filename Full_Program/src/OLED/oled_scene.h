@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Retained scene for the OLED
+ *
+ *  A full 96x96 RGB565 frame needs 18 KB, more than the RAM of the device. The
+ *  scene keeps a display list of the items to draw instead, and renders it in
+ *  horizontal strips of OLED_SCENE_STRIP_LINES lines: each strip is built in
+ *  RAM from all the items that cross it, in the order they were added, and
+ *  sent in a single SPI transfer while the next strip is built in a second
+ *  buffer. Later items are drawn over earlier ones, so text can be placed
+ *  over an image or a rectangle.
+ *
+ *  The items stay in the scene until oledc_scene_clear, a screen is redrawn
+ *  with oledc_scene_render or only some of its lines with
+ *  oledc_scene_render_lines.
+ */
+
+#ifndef OLED_SCENE_H
+#define	OLED_SCENE_H
+
+#include "oled.h"
+
+// Lines of the two strip buffers, 2 x 96 x 8 x 2 bytes of RAM
+#ifndef OLED_SCENE_STRIP_LINES
+#define OLED_SCENE_STRIP_LINES  8
+#endif
+
+// Items of the display list
+#ifndef OLED_SCENE_MAX_ITEMS
+#define OLED_SCENE_MAX_ITEMS    24
+#endif
+
+// Characters of all the text items together, the strings are copied
+#ifndef OLED_SCENE_TEXT_SIZE
+#define OLED_SCENE_TEXT_SIZE    128
+#endif
+
+// Compressed images in the scene, each one has a decoder of 12 bytes
+#ifndef OLED_SCENE_MAX_IMAGES
+#define OLED_SCENE_MAX_IMAGES   2
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ *  @brief This API removes all items and sets the background color.
+ *
+ *  @param[in] bg_color : Color of the pixels no item covers
+ */
+void oledc_scene_clear(uint16_t bg_color);
+
+/*!
+ *  @brief This API adds a filled rectangle to the scene.
+ *
+ *  @param[in] start_x : Start X coordinate
+ *  @param[in] start_y : Start Y coordinate
+ *  @param[in] end_x : End X coordinate
+ *  @param[in] end_y : End Y coordinate
+ *  @param[in] color : Color of the rectangle
+ *
+ *  @return false when the display list is full
+ */
+bool oledc_scene_rectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+/*!
+ *  @brief This API adds a string to the scene. Only the pixels of the
+ *  characters are drawn, the items below stay visible around them.
+ *
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] sx : The multiplication order on the character on the X axis
+ *  @param[in] sy : The multiplication order on the character on the Y axis
+ *  @param[in] *string : Pointer towards the string, it is copied
+ *  @param[in] color : Color of the text
+ *
+ *  @return false when the display list or the text space is full
+ */
+bool oledc_scene_string(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, const char *string, uint16_t color);
+
+/*!
+ *  @brief This API adds a string on a specified background to the scene.
+ *
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] sx : The multiplication order on the character on the X axis
+ *  @param[in] sy : The multiplication order on the character on the Y axis
+ *  @param[in] *string : Pointer towards the string, it is copied
+ *  @param[in] color : Color of the text
+ *  @param[in] bg_color : Color of the background
+ *
+ *  @return false when the display list or the text space is full
+ */
+bool oledc_scene_string_on_bg(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, const char *string, uint16_t color, uint16_t bg_color);
+
+/*!
+ *  @brief This API adds an image to the scene.
+ *  The image should be of RGB565 format, low byte first as for
+ *  oledc_draw_image. It is not copied and must stay valid.
+ *
+ *  @param[in] start_x : Start X coordinate
+ *  @param[in] start_y : Start Y coordinate
+ *  @param[in] end_x : End X coordinate
+ *  @param[in] end_y : End Y coordinate
+ *  @param[in] *img : Pointer towards the image
+ *
+ *  @return false when the display list is full
+ */
+bool oledc_scene_image(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, const uint8_t *img);
+
+/*!
+ *  @brief This API adds a compressed image to the scene, see oled_image.h
+ *  for the format. It is not copied and must stay valid.
+ *
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] *image : Pointer towards the compressed image
+ *
+ *  @return false when the display list or the decoders are full
+ */
+bool oledc_scene_rle_image(uint8_t x, uint8_t y, const uint8_t *image);
+
+/*!
+ *  @brief This API draws the whole scene on the display.
+ */
+void oledc_scene_render(void);
+
+/*!
+ *  @brief This API draws the lines start_y to end_y of the scene.
+ *
+ *  @param[in] start_y : First line
+ *  @param[in] end_y : Last line
+ */
+void oledc_scene_render_lines(uint8_t start_y, uint8_t end_y);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* OLED_SCENE_H */
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "oled_screen.h"
+#include "oled_scene.h"
+#include "oled_widget.h"
+#include "oled_chart.h"
+
+// a label and a value per line, the labels are drawn once
+static oledc_widget oled_labels[3];
+static oledc_widget oled_values[3];
+static const char *oled_label_text[3] = {"Temp:", "Mois:", "CO2:"};
+// CO2 of the last 95 readings on the bottom lines
+static oledc_chart co2_chart;
+
+void oledc_screen_splash(void)
+{
+    // the title is composed over the logo in the strip buffer
+    oledc_scene_clear(BLACK);
+    oledc_scene_rle_image(0, 0, curiosity_logo_color);
+    oledc_scene_string(2, 2, 1, 1, "  SAMD21 Demo  ", BLUE);
+    oledc_scene_render();
+}
+
+void oledc_screen_sensor(void)
+{
+    oledc_fill_screen(BLACK);
+    oledc_draw_string(2, 2, 1, 2, "  SAMD21 Demo  ", GREEN);
+    for(uint8_t i = 0; i < 3; i++)
+    {
+        oledc_widget_init(&oled_labels[i], 2, 20 + 20 * i, 1, 2, 6, GREEN, BLACK);
+        oledc_widget_init(&oled_values[i], 38, 20 + 20 * i, 1, 2, 10, GREEN, BLACK);
+    }
+    oledc_chart_init(&co2_chart, 0, 78, 96, 18, 100, YELLOW, BLACK);
+}
+
+void oledc_screen_sensor_update(int16_t temperature, int16_t humidity, uint16_t co2, bool alarm)
+{
+    char msg[20];
+
+    // only the characters that changed since the last reading are drawn
+    oledc_widget_set_color(&oled_labels[2], alarm ? RED : GREEN, BLACK);
+    oledc_widget_set_color(&oled_values[2], alarm ? RED : GREEN, BLACK);
+    for(uint8_t i = 0; i < 3; i++)
+    {
+        oledc_widget_print(&oled_labels[i], oled_label_text[i]);
+    }
+    sprintf(msg, "%.1f C", (float)temperature/100);
+    oledc_widget_print(&oled_values[0], msg);
+    sprintf(msg, "%.1f %%RH", (float)humidity/100);
+    oledc_widget_print(&oled_values[1], msg);
+    sprintf(msg, "%d ppm", co2);
+    oledc_widget_print(&oled_values[2], msg);
+    oledc_chart_add(&co2_chart, co2);
+}
+
+void oledc_screen_sensor_redraw_chart(void)
+{
+    oledc_chart_redraw(&co2_chart);
+}
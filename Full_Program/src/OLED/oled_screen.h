@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Screens of the application
+ *
+ *  The splash and sensor screen layouts are kept here, apart from the tasks
+ *  that fill them, so the host emulator in tools/ssd1351_emu draws the very
+ *  screens of the firmware and its golden snapshots cover them.
+ *
+ *  The sensor screen has a label and a value per line, drawn as widgets so
+ *  a new reading only redraws the characters that changed, and the CO2 of
+ *  the last 95 readings as a chart on the bottom lines.
+ */
+
+#ifndef OLED_SCREEN_H
+#define	OLED_SCREEN_H
+
+#include "oled.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ *  @brief This API shows the splash screen, the title over the logo.
+ */
+void oledc_screen_splash(void);
+
+/*!
+ *  @brief This API clears the display and sets up the sensor screen. The
+ *  lines are drawn by the first oledc_screen_sensor_update.
+ */
+void oledc_screen_sensor(void);
+
+/*!
+ *  @brief This API shows a reading on the sensor screen and adds the CO2 to
+ *  the chart.
+ *
+ *  @param[in] temperature : Temperature in 1/100 C
+ *  @param[in] humidity : Relative humidity in 1/100 %
+ *  @param[in] co2 : CO2 in ppm
+ *  @param[in] alarm : Draws the CO2 line in red
+ */
+void oledc_screen_sensor_update(int16_t temperature, int16_t humidity, uint16_t co2, bool alarm);
+
+/*!
+ *  @brief This API draws the chart of the sensor screen again, after
+ *  something else was drawn over it.
+ */
+void oledc_screen_sensor_redraw_chart(void);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* OLED_SCREEN_H */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include "oled_widget.h"
+
+#define OLED_WIDGET_CELL(sx)    (OLED_FONT_WIDTH * (sx) + 1)
+
+void oledc_widget_init(oledc_widget *widget, uint8_t x, uint8_t y, uint8_t sx, uint8_t sy,
+                       uint8_t width, uint16_t color, uint16_t bg_color)
+{
+    uint8_t fit;
+
+    sx = sx ? sx : 1;
+    sy = sy ? sy : 1;
+    // the last character must end on the display, the gap after it may not
+    fit = x < SSD1351_SCREEN_WIDTH ? (SSD1351_SCREEN_WIDTH - x + 1) / OLED_WIDGET_CELL(sx) : 0;
+    width = width > fit ? fit : width;
+    widget->x = x;
+    widget->y = y;
+    widget->sx = sx;
+    widget->sy = sy;
+    widget->width = width > OLED_WIDGET_MAX_CHARS ? OLED_WIDGET_MAX_CHARS : width;
+    widget->color = color;
+    widget->bg_color = bg_color;
+    widget->valid = false;
+}
+
+uint8_t oledc_widget_print(oledc_widget *widget, const char *text)
+{
+    char run[OLED_WIDGET_MAX_CHARS + 1];
+    uint8_t i, start = 0, length = 0, drawn = 0;
+    char ch;
+
+    for (i = 0; i <= widget->width; i++)
+    {
+        ch = ' ';
+        if (i < widget->width && *text)
+        {
+            ch = *text++;
+        }
+        // characters that differ are collected in runs, each run is drawn
+        // with one call
+        if (i < widget->width && (!widget->valid || widget->text[i] != ch))
+        {
+            if (length == 0)
+            {
+                start = i;
+            }
+            run[length++] = ch;
+            widget->text[i] = ch;
+        }
+        else if (length)
+        {
+            run[length] = '\0';
+            oledc_draw_string_on_bg(widget->x + start * OLED_WIDGET_CELL(widget->sx), widget->y,
+                                    widget->sx, widget->sy, run, widget->color, widget->bg_color);
+            drawn += length;
+            length = 0;
+        }
+    }
+    widget->valid = true;
+    return drawn;
+}
+
+void oledc_widget_set_color(oledc_widget *widget, uint16_t color, uint16_t bg_color)
+{
+    if (widget->color != color || widget->bg_color != bg_color)
+    {
+        widget->color = color;
+        widget->bg_color = bg_color;
+        widget->valid = false;
+    }
+}
+
+void oledc_widget_invalidate(oledc_widget *widget)
+{
+    widget->valid = false;
+}
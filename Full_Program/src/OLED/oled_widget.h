@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Text widgets for the OLED
+ *
+ *  A widget is a text field with a fixed position, scale, colors and width in
+ *  characters. It keeps the text that is on the display, so a new text only
+ *  redraws the characters that differ: a value whose last digit changed costs
+ *  one glyph instead of the whole line. Texts shorter than the width are
+ *  padded with spaces, longer ones are cut.
+ *
+ *  The widget only knows what it drew itself. After something else was drawn
+ *  over it, e.g. oledc_fill_screen, oledc_widget_invalidate makes the next
+ *  oledc_widget_print redraw all of it.
+ */
+
+#ifndef OLED_WIDGET_H
+#define	OLED_WIDGET_H
+
+#include "oled.h"
+
+// Characters of a widget, 16 fill a line at sx = 1
+#ifndef OLED_WIDGET_MAX_CHARS
+#define OLED_WIDGET_MAX_CHARS   16
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+    uint8_t sx;
+    uint8_t sy;
+    uint8_t width;              // characters
+    bool valid;                 // text is what the display shows
+    uint16_t color;
+    uint16_t bg_color;
+    char text[OLED_WIDGET_MAX_CHARS];
+} oledc_widget;
+
+/*!
+ *  @brief This API sets up a widget. Nothing is drawn until the first
+ *  oledc_widget_print.
+ *
+ *  @param[out] *widget : The widget
+ *  @param[in] x : Start X coordinate
+ *  @param[in] y : Start Y coordinate
+ *  @param[in] sx : The multiplication order on the character on the X axis
+ *  @param[in] sy : The multiplication order on the character on the Y axis
+ *  @param[in] width : Characters of the field, it is cut at the right edge
+ *                     of the display and at OLED_WIDGET_MAX_CHARS
+ *  @param[in] color : Color of the text
+ *  @param[in] bg_color : Color of the background
+ */
+void oledc_widget_init(oledc_widget *widget, uint8_t x, uint8_t y, uint8_t sx, uint8_t sy,
+                       uint8_t width, uint16_t color, uint16_t bg_color);
+
+/*!
+ *  @brief This API shows a text in the widget, only the characters that
+ *  differ from the ones on the display are drawn.
+ *
+ *  @param[in] *widget : The widget
+ *  @param[in] *text : The text
+ *
+ *  @return The number of characters drawn
+ */
+uint8_t oledc_widget_print(oledc_widget *widget, const char *text);
+
+/*!
+ *  @brief This API changes the colors of the widget. The next
+ *  oledc_widget_print redraws all of it if they differ.
+ *
+ *  @param[in] *widget : The widget
+ *  @param[in] color : Color of the text
+ *  @param[in] bg_color : Color of the background
+ */
+void oledc_widget_set_color(oledc_widget *widget, uint16_t color, uint16_t bg_color);
+
+/*!
+ *  @brief This API makes the next oledc_widget_print redraw all of the
+ *  widget, after the display was drawn over.
+ *
+ *  @param[in] *widget : The widget
+ */
+void oledc_widget_invalidate(oledc_widget *widget);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* OLED_WIDGET_H */
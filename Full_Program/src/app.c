@@ -24,37 +24,37 @@
 #include "definitions.h"
 
 #include "OLED/oled.h"
+#include "OLED/oled_screen.h"
+#include "OLED/oled_widget.h"
 #include "sensirion/sensirion_api.h"
+#include "hal/i2c_queue.h"
+#include "tasks.h"
+#include "app.h"
 
+// CO2 levels to raise and to clear the alarm, apart so it does not toggle
+#define CO2_ALARM_PPM           1500
+#define CO2_ALARM_CLEAR_PPM     1200
 
-bool button_set = false;
-bool button_state = false;
+// Calls timed by the 'd' command, the millisecond tick gives 10 us steps
+#define OLED_BENCH_RUNS         100
+
+static bool csv_enabled = false;
+static bool co2_alarm = false;
 
 void handle_button(uintptr_t context) 
 {
-    button_set = true;
-
-    if (SW0_Get() == 0)
-    {
-        button_state = true;
-    }
-    else
-    {
-        button_state = false;
-    }  
+    // the state is read at the edge, button_task handles it later
+    Task_post(TASK_BUTTON, SW0_Get() == 0);
 }
 
-void execute_button_task(void)
+void button_task(uintptr_t context)
 {
-    if(button_set)
+    bool pressed = Task_payload();
+    
+    if(pressed)
     {
-        button_set = false;
-        if(button_state)
-        {
-            sensirion_print_data();  
-        }
-            
-    }    
+        sensirion_print_data();  
+    }
 }
 
 void print_header(void)
@@ -65,29 +65,134 @@ void print_header(void)
     printf("Curiosity Nano Board > 1[None] 2[OLED] 3[HVAC Click]\r\n");
     
     printf("\r\nProgram Running: \r\n");
-    printf("- Each 5s: Read sensor data\r\n");
+    printf("- Each 2s: Read sensor data, new data updates display and alarm\r\n");
     printf("- User interaction: key press/release prints sensor data\r\n");
     printf("\r\nType following commands to interact:\r\n\r\n");
     printf(" w - Print weather info \r\n");
     printf(" c - Clear screen\r\n");
     printf(" a - Print Hello World\r\n");
+    printf(" t - Print task timing statistics\r\n");
+    printf(" v - Toggle CSV output of new sensor data\r\n");
+    printf(" d - Time the drawing of a line on the display\r\n");
+    printf(" i - Print I2C error and recovery counters\r\n");
 }
 
 void init_modules(void)
 {
     OLEDC_initialize();
-    oledc_print_curiosity_logo();
+    // the layouts are in oled_screen.c, shared with the host emulator
+    oledc_screen_splash();
     sensirion_init();
-    
-    oledc_fill_screen(BLACK);
-    oledc_draw_string(2, 2, 1, 2, "  SAMD21 Demo  ", GREEN);
+    oledc_screen_sensor();
 }
 
-void toggle_led(void)
+void toggle_led(uintptr_t context)
 {
     LED_Toggle();
 }
 
+void sensor_task(uintptr_t context)
+{
+    static uint32_t published = 0;
+    sensirion_data *sensor = sensirion_get_data();
+    
+    sensirion_read_data();
+    // the stages subscribed to the topic only run when there is new data
+    if(sensor->version != published)
+    {
+        published = sensor->version;
+        Task_publish(TOPIC_SENSOR_DATA, published);
+    }
+}
+
+void csv_task(uintptr_t context)
+{
+    if(csv_enabled && Task_payload() == Task_topic_version(TOPIC_SENSOR_DATA))
+    {
+        sensirion_print_csv_data();
+    }
+}
+
+void alarm_task(uintptr_t context)
+{
+    sensirion_data *sensor = sensirion_get_data();
+    
+    if(!co2_alarm && sensor->scd4x.co2 >= CO2_ALARM_PPM)
+    {
+        co2_alarm = true;
+        printf("Alarm: CO2 %d ppm\r\n", sensor->scd4x.co2);
+    }
+    else if(co2_alarm && sensor->scd4x.co2 < CO2_ALARM_CLEAR_PPM)
+    {
+        co2_alarm = false;
+        printf("Alarm cleared: CO2 %d ppm\r\n", sensor->scd4x.co2);
+    }
+}
+
+void print_task_stats(void)
+{
+    Task_stats stats;
+    Task_load load;
+
+    printf("\r\nid task      runs  last   min   avg   max   lat  lmax  ovr\r\n");
+    for(uint8_t i = 0; i < MAX_TASKS; i++)
+    {
+        if(!Task_get_stats(i, &stats)) continue;
+        printf("%2u %-7s %6lu %5lu %5lu %5lu %5lu %5lu %5lu %4lu\r\n",
+               i, stats.name ? stats.name : "-", stats.runs, stats.last_us,
+               stats.min_us, stats.avg_us, stats.max_us, stats.latency_us,
+               stats.latency_max_us, stats.overruns);
+    }
+    Task_get_load(&load, true);
+    printf("times in us - last %lu ms: tasks %u%%, sleep %u%%, idle loops %lu\r\n",
+           load.window_ms, load.task_load, load.sleep, load.idle_loops);
+    printf("events dropped: %lu, planned worst busy window: %lu us\r\n",
+           Task_events_dropped(), Task_get_busy_window());
+}
+
+void print_i2c_stats(void)
+{
+    I2C_queue_stats stats;
+
+    I2C_queue_get_stats(&stats, true);
+    printf("\r\nI2C since last 'i': %lu transactions, %lu failed, longest %lu ms\r\n",
+           stats.transactions, stats.failed, stats.longest_ms);
+    printf("NAKs %lu, retries %lu, bus errors %lu, timeouts %lu, bus clears %lu\r\n",
+           stats.naks, stats.retries, stats.bus_errors, stats.timeouts, stats.recoveries);
+}
+
+void print_oled_benchmark(void)
+{
+    uint32_t start, elapsed_ms, hits, misses;
+    oledc_widget bench;
+    
+    // same line size as print_oled_data, over the chart that is redrawn after
+    start = SYSTICK_GetTickCounter();
+    for(uint8_t i = 0; i < OLED_BENCH_RUNS; i++)
+    {
+        oledc_draw_string_on_bg(2, 78, 1, 2, "Bench: 1234 ppm ", WHITE, BLACK);
+    }
+    elapsed_ms = SYSTICK_GetTickCounter() - start;
+    oledc_draw_rectangle(0, 78, 95, 95, BLACK);
+    oledc_glyph_cache_stats(&hits, &misses, true);
+    printf("oledc_draw_string_on_bg, 16 chars: %lu us per call\r\n",
+           elapsed_ms * 1000 / OLED_BENCH_RUNS);
+    printf("glyph cache since last 'd': %lu hits, %lu misses\r\n", hits, misses);
+
+    // the same line as a widget where only the last digit changes
+    oledc_widget_init(&bench, 2, 78, 1, 2, 16, WHITE, BLACK);
+    oledc_widget_print(&bench, "Bench: 1234 ppm ");
+    start = SYSTICK_GetTickCounter();
+    for(uint8_t i = 0; i < OLED_BENCH_RUNS; i++)
+    {
+        oledc_widget_print(&bench, i & 1 ? "Bench: 1234 ppm " : "Bench: 1235 ppm ");
+    }
+    elapsed_ms = SYSTICK_GetTickCounter() - start;
+    oledc_screen_sensor_redraw_chart();
+    printf("oledc_widget_print, 1 of 16 chars changed: %lu us per call\r\n",
+           elapsed_ms * 1000 / OLED_BENCH_RUNS);
+}
+
 void handle_USART_cmd(void)
 {
     char buffer[5];
@@ -102,23 +207,23 @@ void handle_USART_cmd(void)
             case 'c': print_header();               break;
             case 'w': sensirion_print_data();       break;
             case 'a': printf("Hello World!\r\n");   break; 
+            case 't': print_task_stats();           break;
+            case 'v': csv_enabled = !csv_enabled;   break;
+            case 'd': print_oled_benchmark();       break;
+            case 'i': print_i2c_stats();            break;
             default: break;
         }
     } 
 }
 
-void print_oled_data(void)
+void print_oled_data(uintptr_t context)
 {    
     sensirion_data *sensor = sensirion_get_data();
-    char msg[20];
-    if(sensor != NULL)
+    // a redraw behind the sensor skips the versions already replaced
+    if(sensor != NULL && Task_payload() == Task_topic_version(TOPIC_SENSOR_DATA))
     {
-        sprintf(msg, "Temp: %.1f C    ", (float)sensor->sen5x.temperature/100);
-        oledc_draw_string_on_bg(2, 20, 1, 2, msg, GREEN, BLACK);
-        sprintf(msg, "Mois: %.1f %%RH ", (float)sensor->sen5x.humidity/100);
-        oledc_draw_string_on_bg(2, 40, 1, 2, msg, GREEN, BLACK);
-        sprintf(msg, "CO2:  %d ppm     ", sensor->scd4x.co2);
-        oledc_draw_string_on_bg(2, 60, 1, 2, msg, GREEN, BLACK);
+        oledc_screen_sensor_update(sensor->sen5x.temperature, sensor->sen5x.humidity,
+                                   sensor->scd4x.co2, co2_alarm);
     }
 }
 
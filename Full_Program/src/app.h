@@ -21,11 +21,17 @@
 
 void handle_button(uintptr_t context);
 void print_header(void);
-void print_oled_data(void);
-void toggle_led(void);
+void print_oled_data(uintptr_t context);
+void toggle_led(uintptr_t context);
+void sensor_task(uintptr_t context);
 void init_modules(void);
 void handle_USART_cmd(void);
-void execute_button_task(void);
+void print_task_stats(void);
+void print_i2c_stats(void);
+void print_oled_benchmark(void);
+void button_task(uintptr_t context);
+void csv_task(uintptr_t context);
+void alarm_task(uintptr_t context);
 
 #endif /* _APP_H */
 
@@ -445,3 +445,18 @@ int SERCOM5_USART_ReadByte( void )
     return (int)SERCOM5_REGS->USART_INT.SERCOM_DATA;
 }
 
+void SERCOM5_USART_ReceiverWakeupEnable( void )
+{
+    /* Only used to leave WFI: the interrupt is never serviced, the received
+     * byte stays in DATA for SERCOM5_USART_ReadByte() */
+    SERCOM5_REGS->USART_INT.SERCOM_INTENSET = (uint8_t)SERCOM_USART_INT_INTENSET_RXC_Msk;
+    NVIC_EnableIRQ(SERCOM5_IRQn);
+}
+
+void SERCOM5_USART_ReceiverWakeupDisable( void )
+{
+    SERCOM5_REGS->USART_INT.SERCOM_INTENCLR = (uint8_t)SERCOM_USART_INT_INTENCLR_RXC_Msk;
+    NVIC_DisableIRQ(SERCOM5_IRQn);
+    NVIC_ClearPendingIRQ(SERCOM5_IRQn);
+}
+
@@ -99,6 +99,10 @@ bool SERCOM5_USART_ReceiverIsReady( void );
 
 int SERCOM5_USART_ReadByte( void );
 
+void SERCOM5_USART_ReceiverWakeupEnable( void );
+
+void SERCOM5_USART_ReceiverWakeupDisable( void );
+
 USART_ERROR SERCOM5_USART_ErrorGet( void );
 
 uint32_t SERCOM5_USART_FrequencyGet( void );
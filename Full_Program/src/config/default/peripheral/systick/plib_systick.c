@@ -44,6 +44,13 @@
 
 volatile static SYSTICK_OBJECT systick;
 
+/* SysTick counts per tick period and the longest idle period a single
+ * 24-bit reload value can cover */
+#define SYSTICK_COUNTS_PER_TICK   ((SYSTICK_FREQ / 1000000U) * SYSTICK_INTERRUPT_PERIOD_IN_US)
+#define SYSTICK_MAX_IDLE_TICKS    ((SysTick_LOAD_RELOAD_Msk + 1U) / SYSTICK_COUNTS_PER_TICK)
+/* Shortest reload that can safely be programmed when resynchronising */
+#define SYSTICK_MIN_RELOAD        (SYSTICK_COUNTS_PER_TICK / 100U)
+
 void SYSTICK_TimerInitialize ( void )
 {
     SysTick->CTRL = 0U;
@@ -182,6 +189,83 @@ bool SYSTICK_IsTimeoutReached (SYSTICK_TIMEOUT* timeout)
     return valTimeout;
 
 }
+uint32_t SYSTICK_TicklessIdle (uint32_t idle_ticks)
+{
+    uint32_t ctrl, first, reload, elapsed, remaining;
+    uint32_t passed = 0U;
+    uint32_t skipped;
+
+    if(idle_ticks > SYSTICK_MAX_IDLE_TICKS)
+    {
+        idle_ticks = SYSTICK_MAX_IDLE_TICKS;
+    }
+    if(idle_ticks < 2U)
+    {
+        /* Next tick is due anyway, just wait for it */
+        __DSB();
+        __WFI();
+        return 0U;
+    }
+
+    /* Stretch the running tick so the next interrupt fires idle_ticks
+     * boundaries from now */
+    SysTick->CTRL &= ~(SysTick_CTRL_ENABLE_Msk);
+    first = SysTick->VAL;
+    if(first == 0U)
+    {
+        first = SYSTICK_COUNTS_PER_TICK;
+    }
+    reload = first + ((idle_ticks - 1U) * SYSTICK_COUNTS_PER_TICK);
+    SysTick->LOAD = reload - 1U;
+    SysTick->VAL = 0U;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    __DSB();
+    __WFI();
+
+    /* Reading CTRL clears COUNTFLAG, so it is read only once */
+    ctrl = SysTick->CTRL;
+    SysTick->CTRL = ctrl & ~(SysTick_CTRL_ENABLE_Msk);
+    elapsed = (reload - 1U) - SysTick->VAL;
+    if((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+    {
+        elapsed += reload;
+    }
+
+    /* Tick boundaries crossed while sleeping and the distance to the next */
+    if(elapsed >= first)
+    {
+        passed = 1U + ((elapsed - first) / SYSTICK_COUNTS_PER_TICK);
+        remaining = SYSTICK_COUNTS_PER_TICK - ((elapsed - first) % SYSTICK_COUNTS_PER_TICK);
+    }
+    else
+    {
+        remaining = first - elapsed;
+    }
+    if(remaining < SYSTICK_MIN_RELOAD)
+    {
+        remaining += SYSTICK_COUNTS_PER_TICK;
+        passed++;
+    }
+
+    /* When the stretched period expired the SysTick interrupt is pending and
+     * will count the last boundary itself */
+    skipped = passed;
+    if(((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U) && (skipped > 0U))
+    {
+        skipped--;
+    }
+    systick.tickCounter += skipped;
+
+    /* Finish the current tick, then fall back to the normal period */
+    SysTick->LOAD = remaining - 1U;
+    SysTick->VAL = 0U;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = SYSTICK_COUNTS_PER_TICK - 1U;
+
+    return skipped;
+}
+
 void SYSTICK_TimerCallbackSet ( SYSTICK_CALLBACK callback, uintptr_t context )
 {
    systick.callback = callback;
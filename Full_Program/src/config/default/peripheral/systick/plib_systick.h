@@ -91,6 +91,11 @@ uint32_t SYSTICK_GetTickCounter(void);
 void SYSTICK_StartTimeOut (SYSTICK_TIMEOUT* timeout, uint32_t delay_ms);
 void SYSTICK_ResetTimeOut (SYSTICK_TIMEOUT* timeout);
 bool SYSTICK_IsTimeoutReached (SYSTICK_TIMEOUT* timeout);
+/* Must be called with interrupts disabled. Sleeps until idle_ticks tick
+ * boundaries have passed or another interrupt is pending, compensates the
+ * tick counter and returns the number of ticks that were not signalled
+ * through the SysTick interrupt. */
+uint32_t SYSTICK_TicklessIdle (uint32_t idle_ticks);
 #ifdef __cplusplus // Provide C++ Compatibility
  }
 #endif
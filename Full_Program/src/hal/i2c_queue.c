@@ -0,0 +1,430 @@
+#include "i2c_queue.h"
+#include <string.h>
+
+/*
+ * The waiting transactions form a list through their next pointers, the one
+ * on the bus is taken off it. The SERCOM2 interrupt ends the active one,
+ * starts the next one that is ready and only then calls the callback of the
+ * finished one, so the bus is idle for the time the plib needs to set up a
+ * transfer and not for the time the callback or the main loop take. A NAKed
+ * transaction with retries left goes back to the end of the list with the
+ * tick its backoff ends. The list is only changed with the SERCOM2 interrupt
+ * disabled, or from it.
+ *
+ * The timer of the queue runs until the earliest deadline or end of backoff,
+ * whichever comes first, and calls I2C_queue_poll. A bus error only sets
+ * i2c_queue_fault, the bus clear takes about 100 us and runs from the poll.
+ */
+static I2C_transaction *i2c_queue_head = NULL;
+static I2C_transaction *i2c_queue_tail = NULL;
+static I2C_transaction *i2c_queue_active = NULL;
+static bool i2c_queue_fault = false;
+static TIMER i2c_queue_timer;
+static I2C_queue_stats i2c_queue_stats;
+
+// A callback called from I2C_queue_submit may submit again, the inner call
+// must not enable the interrupt of the outer one
+#define I2C_QUEUE_IRQ_DISABLE()     NVIC_DisableIRQ(I2C_QUEUE_IRQn)
+#define I2C_QUEUE_IRQ_ENABLE()      NVIC_EnableIRQ(I2C_QUEUE_IRQn)
+#define I2C_QUEUE_IRQ_ENABLED()     (NVIC_GetEnableIRQ(I2C_QUEUE_IRQn) != 0U)
+
+// Open drain by hand: the output latch stays low, the direction drives it
+#define I2C_QUEUE_PIN_LOW(pin)      PORT_PinOutputEnable(pin)
+#define I2C_QUEUE_PIN_RELEASE(pin)  PORT_PinInputEnable(pin)
+
+static void I2C_queue_pin_config(PORT_PIN pin, bool gpio)
+{
+    port_group_registers_t *group = (port_group_registers_t *)GET_PORT_GROUP(pin);
+    uint32_t pin_num = ((uint32_t)pin) & 0x1FU;
+
+    if (gpio)
+    {
+        PORT_PinClear(pin);
+        PORT_PinInputEnable(pin);
+        PORT_PinGPIOConfig(pin);
+        group->PORT_PINCFG[pin_num] |= (uint8_t)PORT_PINCFG_INEN_Msk;
+    }
+    else
+    {
+        group->PORT_PINCFG[pin_num] &= (uint8_t)~PORT_PINCFG_INEN_Msk;
+        PORT_PinPeripheralFunctionConfig(pin, I2C_QUEUE_PIN_FUNCTION);
+    }
+}
+
+/*
+ * Bus clear of the I2C specification: a device stuck in the middle of a
+ * byte holds SDA low until it has clocked out its remaining bits, so SCL is
+ * pulsed up to 9 times until SDA is high, then a STOP ends its transfer.
+ * SERCOM2 is initialized again to leave its bus state machine in IDLE.
+ */
+static void I2C_queue_bus_clear(void)
+{
+    uint8_t pulses;
+
+    I2C_queue_pin_config(I2C_QUEUE_SCL_PIN, true);
+    I2C_queue_pin_config(I2C_QUEUE_SDA_PIN, true);
+    I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+    for (pulses = 0; pulses < 9 && PORT_PinRead(I2C_QUEUE_SDA_PIN) == false; pulses++)
+    {
+        I2C_QUEUE_PIN_LOW(I2C_QUEUE_SCL_PIN);
+        I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+        I2C_QUEUE_PIN_RELEASE(I2C_QUEUE_SCL_PIN);
+        I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+    }
+    // STOP: SDA rises while SCL is high
+    I2C_QUEUE_PIN_LOW(I2C_QUEUE_SCL_PIN);
+    I2C_QUEUE_PIN_LOW(I2C_QUEUE_SDA_PIN);
+    I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+    I2C_QUEUE_PIN_RELEASE(I2C_QUEUE_SCL_PIN);
+    I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+    I2C_QUEUE_PIN_RELEASE(I2C_QUEUE_SDA_PIN);
+    I2C_QUEUE_DelayUs(I2C_QUEUE_CLEAR_DELAY_US);
+
+    I2C_queue_pin_config(I2C_QUEUE_SDA_PIN, false);
+    I2C_queue_pin_config(I2C_QUEUE_SCL_PIN, false);
+    I2C_QUEUE_Initialize();
+    i2c_queue_stats.recoveries++;
+}
+
+static bool I2C_queue_transfer(I2C_transaction *transaction)
+{
+    switch (transaction->type)
+    {
+        case I2C_TRANSACTION_WRITE:
+            return I2C_QUEUE_Write(transaction->address, transaction->write_data,
+                                   transaction->write_len);
+        case I2C_TRANSACTION_READ:
+            return I2C_QUEUE_Read(transaction->address, transaction->read_data,
+                                  transaction->read_len);
+        case I2C_TRANSACTION_WRITE_READ:
+            return I2C_QUEUE_WriteRead(transaction->address, transaction->write_data,
+                                       transaction->write_len, transaction->read_data,
+                                       transaction->read_len);
+        default:
+            return false;
+    }
+}
+
+static uint32_t I2C_queue_timeout(const I2C_transaction *transaction)
+{
+    return transaction->timeout_ms ? transaction->timeout_ms : I2C_QUEUE_TIMEOUT_MS;
+}
+
+static void I2C_queue_append(I2C_transaction *transaction)
+{
+    transaction->next = NULL;
+    if (i2c_queue_tail == NULL)
+    {
+        i2c_queue_head = transaction;
+    }
+    else
+    {
+        i2c_queue_tail->next = transaction;
+    }
+    i2c_queue_tail = transaction;
+}
+
+// First transaction whose backoff is over, taken off the list
+static I2C_transaction *I2C_queue_take_ready(uint32_t now)
+{
+    I2C_transaction *prev = NULL;
+    I2C_transaction *transaction = i2c_queue_head;
+
+    while (transaction != NULL && (int32_t)(transaction->ticks - now) > 0)
+    {
+        prev = transaction;
+        transaction = transaction->next;
+    }
+    if (transaction != NULL)
+    {
+        if (prev == NULL)
+        {
+            i2c_queue_head = transaction->next;
+        }
+        else
+        {
+            prev->next = transaction->next;
+        }
+        if (i2c_queue_tail == transaction)
+        {
+            i2c_queue_tail = prev;
+        }
+        transaction->next = NULL;
+    }
+    return transaction;
+}
+
+// Once the status is set the caller may reuse the transaction, its callback
+// is read before
+static void I2C_queue_finish(I2C_transaction *transaction, I2C_TRANSACTION_STATUS status,
+                             SERCOM_I2C_ERROR error)
+{
+    I2C_QUEUE_CALLBACK callback = transaction->callback;
+    uintptr_t context = transaction->context;
+    uint32_t elapsed = I2C_QUEUE_GetTicks() - transaction->submitted;
+
+    i2c_queue_stats.transactions++;
+    if (status != I2C_TRANSACTION_DONE)
+    {
+        i2c_queue_stats.failed++;
+    }
+    if (elapsed > i2c_queue_stats.longest_ms)
+    {
+        i2c_queue_stats.longest_ms = elapsed;
+    }
+    transaction->error = error;
+    transaction->status = status;
+    if (callback != NULL)
+    {
+        callback(context);
+    }
+}
+
+// Runs the timer until the next deadline or end of backoff
+static void I2C_queue_arm(uint32_t now)
+{
+    I2C_transaction *transaction;
+    uint32_t wake = now;
+    bool armed = false;
+
+    if (i2c_queue_fault)
+    {
+        armed = true;
+    }
+    else if (i2c_queue_active != NULL)
+    {
+        // the poll aborts once more than the timeout is over
+        wake = i2c_queue_active->ticks + I2C_queue_timeout(i2c_queue_active) + 1U;
+        armed = true;
+    }
+    else
+    {
+        for (transaction = i2c_queue_head; transaction != NULL; transaction = transaction->next)
+        {
+            if (!armed || (int32_t)(transaction->ticks - wake) < 0)
+            {
+                wake = transaction->ticks;
+                armed = true;
+            }
+        }
+    }
+    if (!armed)
+    {
+        Timer_stop(&i2c_queue_timer);
+    }
+    else
+    {
+        Timer_start(&i2c_queue_timer, (int32_t)(wake - now) > 0 ? wake - now : 1U);
+    }
+}
+
+// A callback may submit while the loop runs, and start a transfer itself
+static void I2C_queue_start(void)
+{
+    I2C_transaction *transaction;
+    uint32_t now = I2C_QUEUE_GetTicks();
+
+    while (i2c_queue_active == NULL && !i2c_queue_fault)
+    {
+        transaction = I2C_queue_take_ready(now);
+        if (transaction == NULL)
+        {
+            break;
+        }
+        transaction->tries++;
+        transaction->ticks = now;
+        transaction->status = I2C_TRANSACTION_BUSY;
+        if (I2C_queue_transfer(transaction))
+        {
+            i2c_queue_active = transaction;
+            break;
+        }
+        // the plib refused the transfer, i.e. a length of 0
+        I2C_queue_finish(transaction, I2C_TRANSACTION_ERROR, SERCOM_I2C_ERROR_BUS);
+    }
+    I2C_queue_arm(now);
+}
+
+static void I2C_queue_callback(uintptr_t context)
+{
+    I2C_transaction *transaction = i2c_queue_active;
+    SERCOM_I2C_ERROR error;
+
+    (void)context;
+    if (transaction == NULL)
+    {
+        return;
+    }
+    i2c_queue_active = NULL;
+    error = I2C_QUEUE_ErrorGet();
+    if (error == SERCOM_I2C_ERROR_NAK)
+    {
+        i2c_queue_stats.naks++;
+        if (transaction->tries <= transaction->retries)
+        {
+            // the device is busy, let the others use the bus meanwhile
+            i2c_queue_stats.retries++;
+            transaction->ticks = I2C_QUEUE_GetTicks() +
+                                 ((uint32_t)I2C_QUEUE_BACKOFF_MS << (transaction->tries - 1U));
+            transaction->status = I2C_TRANSACTION_QUEUED;
+            I2C_queue_append(transaction);
+            I2C_queue_start();
+            return;
+        }
+    }
+    else if (error == SERCOM_I2C_ERROR_BUS)
+    {
+        i2c_queue_stats.bus_errors++;
+        i2c_queue_fault = true;
+    }
+    I2C_queue_start();
+    I2C_queue_finish(transaction, error == SERCOM_I2C_ERROR_NONE ? I2C_TRANSACTION_DONE
+                                                                 : I2C_TRANSACTION_ERROR, error);
+}
+
+static void I2C_queue_timer_callback(uintptr_t context)
+{
+    (void)context;
+    I2C_queue_poll();
+}
+
+void I2C_queue_init(void)
+{
+    Timer_init(&i2c_queue_timer, I2C_queue_timer_callback, 0);
+    I2C_QUEUE_CallbackRegister(I2C_queue_callback, 0);
+}
+
+static void I2C_queue_fill(I2C_transaction *transaction, I2C_TRANSACTION_TYPE type, uint16_t address)
+{
+    transaction->type = type;
+    transaction->address = address;
+    transaction->callback = NULL;
+    transaction->context = 0;
+    transaction->timeout_ms = 0;
+    transaction->retries = 0;
+    transaction->status = I2C_TRANSACTION_IDLE;
+}
+
+void I2C_queue_write(I2C_transaction *transaction, uint16_t address, uint8_t *data, uint32_t len)
+{
+    I2C_queue_fill(transaction, I2C_TRANSACTION_WRITE, address);
+    transaction->write_data = data;
+    transaction->write_len = len;
+    transaction->read_data = NULL;
+    transaction->read_len = 0;
+}
+
+void I2C_queue_read(I2C_transaction *transaction, uint16_t address, uint8_t *data, uint32_t len)
+{
+    I2C_queue_fill(transaction, I2C_TRANSACTION_READ, address);
+    transaction->write_data = NULL;
+    transaction->write_len = 0;
+    transaction->read_data = data;
+    transaction->read_len = len;
+}
+
+void I2C_queue_write_read(I2C_transaction *transaction, uint16_t address,
+                          uint8_t *write_data, uint32_t write_len,
+                          uint8_t *read_data, uint32_t read_len)
+{
+    I2C_queue_fill(transaction, I2C_TRANSACTION_WRITE_READ, address);
+    transaction->write_data = write_data;
+    transaction->write_len = write_len;
+    transaction->read_data = read_data;
+    transaction->read_len = read_len;
+}
+
+bool I2C_queue_submit(I2C_transaction *transaction)
+{
+    bool enabled;
+
+    if (I2C_queue_pending(transaction))
+    {
+        return false;
+    }
+    transaction->status = I2C_TRANSACTION_QUEUED;
+    transaction->error = SERCOM_I2C_ERROR_NONE;
+    transaction->tries = 0;
+    transaction->submitted = I2C_QUEUE_GetTicks();
+    transaction->ticks = transaction->submitted;
+
+    enabled = I2C_QUEUE_IRQ_ENABLED();
+    I2C_QUEUE_IRQ_DISABLE();
+    I2C_queue_append(transaction);
+    if (i2c_queue_active == NULL)
+    {
+        I2C_queue_start();
+    }
+    if (enabled)
+    {
+        I2C_QUEUE_IRQ_ENABLE();
+    }
+    return true;
+}
+
+void I2C_queue_poll(void)
+{
+    I2C_transaction *expired = NULL;
+    bool enabled = I2C_QUEUE_IRQ_ENABLED();
+
+    I2C_QUEUE_IRQ_DISABLE();
+    if (i2c_queue_active != NULL &&
+        I2C_QUEUE_GetTicks() - i2c_queue_active->ticks > I2C_queue_timeout(i2c_queue_active))
+    {
+        expired = i2c_queue_active;
+        i2c_queue_active = NULL;
+        I2C_QUEUE_TransferAbort();
+        i2c_queue_stats.timeouts++;
+        i2c_queue_fault = true;
+    }
+    if (i2c_queue_fault)
+    {
+        I2C_queue_bus_clear();
+        i2c_queue_fault = false;
+    }
+    I2C_queue_start();
+    if (enabled)
+    {
+        I2C_QUEUE_IRQ_ENABLE();
+    }
+    if (expired != NULL)
+    {
+        I2C_queue_finish(expired, I2C_TRANSACTION_TIMEOUT, SERCOM_I2C_ERROR_NONE);
+    }
+}
+
+bool I2C_queue_pending(const I2C_transaction *transaction)
+{
+    return transaction->status == I2C_TRANSACTION_QUEUED ||
+           transaction->status == I2C_TRANSACTION_BUSY;
+}
+
+bool I2C_queue_wait(const I2C_transaction *transaction)
+{
+    while (I2C_queue_pending(transaction))
+    {
+        I2C_queue_poll();
+    }
+    return transaction->status == I2C_TRANSACTION_DONE;
+}
+
+bool I2C_queue_is_busy(void)
+{
+    return i2c_queue_active != NULL || i2c_queue_head != NULL;
+}
+
+void I2C_queue_get_stats(I2C_queue_stats *stats, bool reset)
+{
+    bool enabled = I2C_QUEUE_IRQ_ENABLED();
+
+    I2C_QUEUE_IRQ_DISABLE();
+    *stats = i2c_queue_stats;
+    if (reset)
+    {
+        memset(&i2c_queue_stats, 0, sizeof(i2c_queue_stats));
+    }
+    if (enabled)
+    {
+        I2C_QUEUE_IRQ_ENABLE();
+    }
+}
@@ -0,0 +1,237 @@
+/* ************************************************************************** */
+/** I2C transaction queue
+
+  @File Name
+    i2c_queue.h
+
+  @Summary
+    Interrupt driven queue of I2C transactions on SERCOM2.
+
+  @Description
+    The SERCOM2 plib handles one transfer at a time and calls back from its
+    interrupt when the transfer is done. The queue keeps a list of
+    transactions, provided by the callers, and starts the next one from that
+    interrupt, so the bus never waits for the main loop between transfers.
+
+    A transaction is a write, a read or a write followed by a repeated start
+    and a read. It is filled by I2C_queue_write, I2C_queue_read or
+    I2C_queue_write_read, and must stay valid, with its buffers, until it is
+    no longer pending.
+
+    A transaction on the bus for longer than its timeout is aborted, and so
+    is the plib: the queue then clocks SCL by hand until a device holding
+    SDA low lets go, sends a STOP and initializes SERCOM2 again. The same
+    recovery follows a bus error. A transaction NAKed by the device, such as
+    a SCD4x still busy with the last command, can be retried after a backoff
+    that doubles with each try; meanwhile the other transactions use the
+    bus. The deadlines and the backoffs are checked from a software timer,
+    see timer_wheel.h, and by I2C_queue_wait, so the longest time a call can
+    block is known from the timeouts and the retries.
+ */
+/* ************************************************************************** */
+
+#ifndef _I2C_QUEUE_H    /* Guard against multiple inclusion */
+#define _I2C_QUEUE_H
+
+#include "definitions.h"
+#include "timer_wheel.h"
+
+// I2C Definitions
+#define I2C_QUEUE_Write                     SERCOM2_I2C_Write
+#define I2C_QUEUE_Read                      SERCOM2_I2C_Read
+#define I2C_QUEUE_WriteRead                 SERCOM2_I2C_WriteRead
+#define I2C_QUEUE_ErrorGet                  SERCOM2_I2C_ErrorGet
+#define I2C_QUEUE_CallbackRegister          SERCOM2_I2C_CallbackRegister
+#define I2C_QUEUE_TransferAbort             SERCOM2_I2C_TransferAbort
+#define I2C_QUEUE_Initialize                SERCOM2_I2C_Initialize
+#define I2C_QUEUE_IRQn                      SERCOM2_IRQn
+
+// Pins of the bus clear, given back to SERCOM2 afterwards
+#define I2C_QUEUE_SDA_PIN                   SDA_PIN
+#define I2C_QUEUE_SCL_PIN                   SCL_PIN
+#define I2C_QUEUE_PIN_FUNCTION              PERIPHERAL_FUNCTION_C
+
+// Timer Definitions
+#define I2C_QUEUE_GetTicks                  SYSTICK_GetTickCounter
+#define I2C_QUEUE_DelayUs                   SYSTICK_DelayUs
+
+// Time on the bus of a transaction with a timeout of 0
+#ifndef I2C_QUEUE_TIMEOUT_MS
+#define I2C_QUEUE_TIMEOUT_MS                20
+#endif
+
+// Wait before the first retry of a NAKed transaction, doubled on each retry
+#ifndef I2C_QUEUE_BACKOFF_MS
+#define I2C_QUEUE_BACKOFF_MS                2
+#endif
+
+// Half period of SCL during the bus clear, 100 kHz
+#define I2C_QUEUE_CLEAR_DELAY_US            5
+
+typedef enum
+{
+    I2C_TRANSACTION_WRITE,
+    I2C_TRANSACTION_READ,
+    I2C_TRANSACTION_WRITE_READ,
+} I2C_TRANSACTION_TYPE;
+
+typedef enum
+{
+    I2C_TRANSACTION_IDLE,       // never submitted
+    I2C_TRANSACTION_QUEUED,     // waiting for the transactions before it
+    I2C_TRANSACTION_BUSY,       // on the bus
+    I2C_TRANSACTION_DONE,
+    I2C_TRANSACTION_ERROR,      // see error
+    I2C_TRANSACTION_TIMEOUT,    // aborted, the bus was cleared
+} I2C_TRANSACTION_STATUS;
+
+typedef void (*I2C_QUEUE_CALLBACK)(uintptr_t context);
+
+typedef struct I2C_transaction
+{
+    I2C_TRANSACTION_TYPE type;
+    uint16_t address;                   // 7-bit address
+    uint8_t *write_data;
+    uint32_t write_len;
+    uint8_t *read_data;
+    uint32_t read_len;
+    I2C_QUEUE_CALLBACK callback;        // or NULL
+    uintptr_t context;
+    uint16_t timeout_ms;                // 0 for I2C_QUEUE_TIMEOUT_MS
+    uint8_t retries;                    // tries after a NAK
+    volatile I2C_TRANSACTION_STATUS status;
+    SERCOM_I2C_ERROR error;             // NAK or bus error of the plib
+    // owned by the queue
+    uint8_t tries;
+    uint32_t submitted;
+    uint32_t ticks;                     // start on the bus, or end of backoff
+    struct I2C_transaction *next;
+} I2C_transaction;
+
+typedef struct
+{
+    uint32_t transactions;              // done or failed
+    uint32_t failed;
+    uint32_t naks;                      // including the retried ones
+    uint32_t retries;
+    uint32_t bus_errors;
+    uint32_t timeouts;
+    uint32_t recoveries;                // bus clears
+    uint32_t longest_ms;                // from submit to the end, with retries
+} I2C_queue_stats;
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief This API registers the queue as the SERCOM2 plib callback.
+ *  The plib must not be used directly afterwards.
+ */
+void I2C_queue_init(void);
+
+/*!
+ *  @brief This API fills a write transaction.
+ *  As the fill functions below it sets the status to I2C_TRANSACTION_IDLE,
+ *  the default timeout, no retries and no callback. It must not be called
+ *  on a pending transaction.
+ *
+ *  @param[out] *transaction : Transaction to fill
+ *  @param[in] address : 7-bit I2C address
+ *  @param[in] *data : Data to be sent
+ *  @param[in] len : Length of the data
+ */
+void I2C_queue_write(I2C_transaction *transaction, uint16_t address, uint8_t *data, uint32_t len);
+
+/*!
+ *  @brief This API fills a read transaction.
+ *
+ *  @param[out] *transaction : Transaction to fill
+ *  @param[in] address : 7-bit I2C address
+ *  @param[in] *data : Buffer for the data read
+ *  @param[in] len : Length of the data
+ */
+void I2C_queue_read(I2C_transaction *transaction, uint16_t address, uint8_t *data, uint32_t len);
+
+/*!
+ *  @brief This API fills a write-read transaction, the read follows the
+ *  write after a repeated start.
+ *
+ *  @param[out] *transaction : Transaction to fill
+ *  @param[in] address : 7-bit I2C address
+ *  @param[in] *write_data : Data to be sent
+ *  @param[in] write_len : Length of the data sent
+ *  @param[in] *read_data : Buffer for the data read
+ *  @param[in] read_len : Length of the data read
+ */
+void I2C_queue_write_read(I2C_transaction *transaction, uint16_t address,
+                          uint8_t *write_data, uint32_t write_len,
+                          uint8_t *read_data, uint32_t read_len);
+
+/*!
+ *  @brief This API adds a transaction at the end of the queue and returns.
+ *  The transaction starts at once when the bus is free. The callback is
+ *  called from the SERCOM2 interrupt once the transaction is done or
+ *  failed, after the next transaction was started, and may submit again.
+ *  A transaction that times out, or that the plib refuses to start, calls
+ *  back from the function that noticed it, in thread context.
+ *
+ *  @param[in] *transaction : Transaction to queue, filled by one of the
+ *                            functions above, then callback, context,
+ *                            timeout_ms and retries set as needed
+ *
+ *  @return false if the transaction is already queued
+ */
+bool I2C_queue_submit(I2C_transaction *transaction);
+
+/*!
+ *  @brief This API checks if a transaction is queued or on the bus.
+ *
+ *  @param[in] *transaction : Transaction to check
+ */
+bool I2C_queue_pending(const I2C_transaction *transaction);
+
+/*!
+ *  @brief This API checks the deadline of the transaction on the bus and
+ *  the backoffs, clears the bus after a timeout or a bus error and starts
+ *  the transactions that are ready. It is called by the software timer of
+ *  the queue and by I2C_queue_wait.
+ */
+void I2C_queue_poll(void);
+
+/*!
+ *  @brief This API waits until a transaction is done or failed.
+ *  At most the timeout of the transaction, times its tries, plus the
+ *  backoffs and the transactions queued before it.
+ *
+ *  @param[in] *transaction : Transaction to wait for
+ *
+ *  @return true if the transaction is done
+ */
+bool I2C_queue_wait(const I2C_transaction *transaction);
+
+/*!
+ *  @brief This API checks if transactions are queued or on the bus.
+ */
+bool I2C_queue_is_busy(void);
+
+/*!
+ *  @brief This API returns the counters of the queue since the last reset.
+ *
+ *  @param[out] *stats : Counters
+ *  @param[in] reset : Restart the counters
+ */
+void I2C_queue_get_stats(I2C_queue_stats *stats, bool reset);
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2C_QUEUE_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -1,35 +1,326 @@
 #include "oled_spi_hal.h"
 
 /*
- * INSTRUCTIONS
- * ============
- *
- * Implement all functions where they are marked as IMPLEMENT.
- * Follow the function specification in the comments.
+ * Asynchronous transfers wait in a software queue of OLED_SPI_QUEUE_SIZE
+ * entries, the first one is on the wire. The DMAC moves one byte to SERCOM1
+ * DATA at each DRE trigger. Channel 0 has a single descriptor and the
+ * transfers are not chained by the DMAC: its transfer complete interrupt
+ * writes the descriptor of the next entry, enables the channel again and
+ * calls the callback of the finished one. The wire is idle for the
+ * interrupt latency between two transfers, and between two blocks of a
+ * fill. The short command and argument writes keep using the polled plib,
+ * setting up the DMAC costs more than sending a few bytes.
  */
+#if OLED_SPI_DMA
+typedef struct {
+    uint8_t *data;
+    size_t len;                 // bytes still to send
+    uint16_t block;             // data bytes, repeated until len is sent
+    uint16_t sent;              // bytes of the block on the wire
+    bool fixed;                 // the source address does not increment
+    OLED_SPI_CALLBACK callback;
+    uintptr_t context;
+} OLED_spi_transfer;
 
-/**
- * Select the current spi bus.
- *
- *
- */
+static OLED_spi_transfer oled_spi_queue[OLED_SPI_QUEUE_SIZE];
+static volatile uint8_t oled_spi_fills = 0;
+
+// Fill pattern, a few pixels so a fill only interrupts once per block
+static uint8_t oled_spi_pattern[OLED_SPI_PATTERN_PIXELS * 2];
+#endif
+static volatile uint8_t oled_spi_count = 0;
+
+#ifdef OLED_SPI_HOST
+#define OLED_SPI_IRQ_DISABLE()
+#define OLED_SPI_IRQ_ENABLE()
+
+static void OLED_spi_start(OLED_spi_transfer *transfer)
+{
+    // the host gets the bytes when the transfer completes
+    transfer->sent = transfer->len;
+}
+
+static void OLED_spi_send(uint8_t *data, size_t len)
+{
+    OLED_spi_host_write(data, len);
+}
+
+static void OLED_spi_fill(uint8_t high, uint8_t low, size_t count)
+{
+    uint8_t pixel[2] = {high, low};
+
+    while (count--)
+    {
+        OLED_spi_host_write(pixel, 2);
+    }
+}
+
+static void OLED_spi_drain(void)
+{
+}
+#else
+#define OLED_SPI_IRQ_DISABLE()  NVIC_DisableIRQ(DMAC_IRQn)
+#define OLED_SPI_IRQ_ENABLE()   NVIC_EnableIRQ(DMAC_IRQn)
+
+// TXC only means something once a byte was sent, so it is only checked
+// after a DMAC transfer, the plib waits for it itself
+static volatile bool oled_spi_shifting = false;
+
+#if OLED_SPI_DMA
+// The DMAC reads the descriptor of channel n at BASEADDR + 16 * n
+static dmac_descriptor_registers_t oled_dma_descriptor[OLED_SPI_DMA_CHANNEL + 1] __ALIGNED(16);
+static dmac_descriptor_registers_t oled_dma_writeback[OLED_SPI_DMA_CHANNEL + 1] __ALIGNED(16);
+
+static void OLED_spi_start(OLED_spi_transfer *transfer)
+{
+    dmac_descriptor_registers_t *descriptor = &oled_dma_descriptor[OLED_SPI_DMA_CHANNEL];
+
+    transfer->sent = transfer->len > transfer->block ? transfer->block : transfer->len;
+    descriptor->DMAC_BTCNT = transfer->sent;
+    if (transfer->fixed)
+    {
+        descriptor->DMAC_BTCTRL = DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BEATSIZE_BYTE |
+                                  DMAC_BTCTRL_BLOCKACT_INT;
+        descriptor->DMAC_SRCADDR = (uint32_t)(uintptr_t)transfer->data;
+    }
+    else
+    {
+        // with SRCINC the source address is the end of the block
+        descriptor->DMAC_BTCTRL = DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BEATSIZE_BYTE |
+                                  DMAC_BTCTRL_SRCINC_Msk | DMAC_BTCTRL_BLOCKACT_INT;
+        descriptor->DMAC_SRCADDR = (uint32_t)(uintptr_t)transfer->data + transfer->sent;
+    }
+    descriptor->DMAC_DSTADDR = (uint32_t)(uintptr_t)&SERCOM1_REGS->SPIM.SERCOM_DATA;
+    descriptor->DMAC_DESCADDR = 0;
+    oled_spi_shifting = true;
+    DMAC_REGS->DMAC_CHID = OLED_SPI_DMA_CHANNEL;
+    DMAC_REGS->DMAC_CHCTRLA = DMAC_CHCTRLA_ENABLE_Msk;
+}
+#endif
+
+static void OLED_spi_send(uint8_t *data, size_t len)
+{
+    SERCOM1_SPI_Write(data, len);
+}
+
+static void OLED_spi_fill(uint8_t high, uint8_t low, size_t count)
+{
+    // the plib handles one buffer per call, a fill only needs DRE
+    while (count--)
+    {
+        while ((SERCOM1_REGS->SPIM.SERCOM_INTFLAG & SERCOM_SPIM_INTFLAG_DRE_Msk) == 0U) ;
+        SERCOM1_REGS->SPIM.SERCOM_DATA = high;
+        while ((SERCOM1_REGS->SPIM.SERCOM_INTFLAG & SERCOM_SPIM_INTFLAG_DRE_Msk) == 0U) ;
+        SERCOM1_REGS->SPIM.SERCOM_DATA = low;
+    }
+    while ((SERCOM1_REGS->SPIM.SERCOM_INTFLAG & SERCOM_SPIM_INTFLAG_TXC_Msk) == 0U) ;
+}
+
+static void OLED_spi_drain(void)
+{
+    // the DMAC is done when the last byte is in DATA, not out of the shifter
+    if (oled_spi_shifting)
+    {
+        while (SERCOM1_SPI_IsTransmitterBusy()) ;
+        oled_spi_shifting = false;
+    }
+}
+#endif
+
+#if OLED_SPI_DMA
+static void OLED_spi_complete(void)
+{
+    OLED_spi_transfer done = oled_spi_queue[0];
+    uint8_t i;
+
+#ifdef OLED_SPI_HOST
+    for (size_t n = 0; n < done.len; n++)
+    {
+        OLED_spi_host_write(&done.data[done.fixed ? 0 : n % done.block], 1);
+    }
+#else
+    // a fill goes on with the next block of the pattern
+    oled_spi_queue[0].len -= done.sent;
+    if (oled_spi_queue[0].len)
+    {
+        OLED_spi_start(&oled_spi_queue[0]);
+        return;
+    }
+#endif
+    if (done.data == oled_spi_pattern)
+    {
+        oled_spi_fills--;
+    }
+    for (i = 1; i < oled_spi_count; i++)
+    {
+        oled_spi_queue[i - 1] = oled_spi_queue[i];
+    }
+    oled_spi_count--;
+    if (oled_spi_count)
+    {
+        OLED_spi_start(&oled_spi_queue[0]);
+    }
+    if (done.callback)
+    {
+        done.callback(done.context);
+    }
+}
+#endif
+
+#ifdef OLED_SPI_HOST
+void OLED_spi_host_complete(void)
+{
+    if (oled_spi_count)
+    {
+        OLED_spi_complete();
+    }
+}
+#elif OLED_SPI_DMA
+void DMAC_Handler(void)
+{
+    DMAC_REGS->DMAC_CHID = OLED_SPI_DMA_CHANNEL;
+    DMAC_REGS->DMAC_CHINTFLAG = DMAC_CHINTFLAG_TCMPL_Msk | DMAC_CHINTFLAG_TERR_Msk;
+    OLED_spi_complete();
+}
+#endif
 
 void OLED_comm_open(void)
 {
-    
+#if OLED_SPI_DMA && !defined(OLED_SPI_HOST)
+    DMAC_REGS->DMAC_CTRL = 0;
+    DMAC_REGS->DMAC_BASEADDR = (uint32_t)(uintptr_t)oled_dma_descriptor;
+    DMAC_REGS->DMAC_WRBADDR = (uint32_t)(uintptr_t)oled_dma_writeback;
+    DMAC_REGS->DMAC_CTRL = DMAC_CTRL_DMAENABLE_Msk | DMAC_CTRL_LVLEN0_Msk;
+
+    DMAC_REGS->DMAC_CHID = OLED_SPI_DMA_CHANNEL;
+    DMAC_REGS->DMAC_CHCTRLA = DMAC_CHCTRLA_SWRST_Msk;
+    while (DMAC_REGS->DMAC_CHCTRLA & DMAC_CHCTRLA_SWRST_Msk) ;
+    DMAC_REGS->DMAC_CHCTRLB = DMAC_CHCTRLB_TRIGSRC(SERCOM1_DMAC_ID_TX) |
+                              DMAC_CHCTRLB_TRIGACT_BEAT | DMAC_CHCTRLB_LVL_LVL0;
+    DMAC_REGS->DMAC_CHINTENSET = DMAC_CHINTENSET_TCMPL_Msk | DMAC_CHINTENSET_TERR_Msk;
+
+    NVIC_SetPriority(DMAC_IRQn, 3);
+    NVIC_EnableIRQ(DMAC_IRQn);
+#endif
 }
 
 void OLED_spi_byteWrite(uint8_t byte)
 {
-    SERCOM1_SPI_Write(&byte, 1);
+    OLED_spi_wait();
+    OLED_spi_send(&byte, 1);
 }
 
 void OLED_spi_Write(uint8_t *data, size_t len)
 {
-    SERCOM1_SPI_Write(data, len);
+    OLED_spi_wait();
+    OLED_spi_send(data, len);
+}
+
+#if OLED_SPI_DMA
+static void OLED_spi_queue_add(uint8_t *data, size_t len, uint16_t block, bool fixed,
+                               OLED_SPI_CALLBACK callback, uintptr_t context)
+{
+    OLED_spi_transfer *transfer;
+
+    OLED_spi_wait_pending(OLED_SPI_QUEUE_SIZE - 1);
+    OLED_SPI_IRQ_DISABLE();
+    transfer = &oled_spi_queue[oled_spi_count];
+    transfer->data = data;
+    transfer->len = len;
+    transfer->block = block;
+    transfer->fixed = fixed;
+    transfer->callback = callback;
+    transfer->context = context;
+    if (oled_spi_count++ == 0)
+    {
+        OLED_spi_start(transfer);
+    }
+    OLED_SPI_IRQ_ENABLE();
+}
+#endif
+
+bool OLED_spi_WriteAsync(uint8_t *data, size_t len, OLED_SPI_CALLBACK callback, uintptr_t context)
+{
+    if (len == 0 || len > UINT16_MAX)
+        return false;
+#if OLED_SPI_DMA
+    OLED_spi_queue_add(data, len, len, false, callback, context);
+#else
+    // blocking fallback, the callback still tells when the buffer is free
+    OLED_spi_send(data, len);
+    if (callback)
+    {
+        callback(context);
+    }
+#endif
+    return true;
+}
+
+void OLED_spi_Fill(uint16_t pattern, size_t count)
+{
+    OLED_spi_wait();
+    OLED_spi_fill(pattern >> 8, pattern & 0x00FF, count);
+}
+
+bool OLED_spi_FillAsync(uint16_t pattern, size_t count, OLED_SPI_CALLBACK callback, uintptr_t context)
+{
+    if (count == 0)
+        return false;
+#if OLED_SPI_DMA
+    uint8_t i;
+
+    // the pattern buffer is shared by the queued fills
+    if (oled_spi_fills)
+    {
+        OLED_spi_wait_pending(0);
+    }
+    for (i = 0; i < OLED_SPI_PATTERN_PIXELS; i++)
+    {
+        oled_spi_pattern[2 * i] = pattern >> 8;
+        oled_spi_pattern[2 * i + 1] = pattern & 0x00FF;
+    }
+    oled_spi_fills++;
+    if ((pattern >> 8) == (pattern & 0x00FF))
+    {
+        // the same byte read over and over, 65535 bytes per block
+        OLED_spi_queue_add(oled_spi_pattern, count * 2, UINT16_MAX, true, callback, context);
+    }
+    else
+    {
+        OLED_spi_queue_add(oled_spi_pattern, count * 2, sizeof(oled_spi_pattern), false,
+                           callback, context);
+    }
+#else
+    OLED_spi_Fill(pattern, count);
+    if (callback)
+    {
+        callback(context);
+    }
+#endif
+    return true;
+}
+
+void OLED_spi_wait_pending(uint8_t pending)
+{
+    while (oled_spi_count > pending)
+    {
+#ifdef OLED_SPI_HOST
+        OLED_spi_host_complete();
+#endif
+    }
 }
 
-bool OLED_spi_is_transmitter_busy()
+void OLED_spi_wait(void)
 {
-    return SERCOM1_SPI_IsTransmitterBusy();
-}
\ No newline at end of file
+    OLED_spi_wait_pending(0);
+    OLED_spi_drain();
+}
+
+bool OLED_spi_is_transmitter_busy(void)
+{
+#ifdef OLED_SPI_HOST
+    return oled_spi_count != 0;
+#else
+    return oled_spi_count != 0 || (oled_spi_shifting && SERCOM1_SPI_IsTransmitterBusy());
+#endif
+}
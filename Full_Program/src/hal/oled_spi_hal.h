@@ -18,8 +18,52 @@
 #ifndef _OLED_SPI_HAL_H    /* Guard against multiple inclusion */
 #define _OLED_SPI_HAL_H
 
+#ifdef OLED_SPI_HOST
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#else
 #include "definitions.h"
+#endif
+
+// Set to 0 to send all the data with the polled SPI plib
+#ifndef OLED_SPI_DMA
+#define OLED_SPI_DMA        1
+#endif
+
+// The host build always emulates the DMAC
+#ifdef OLED_SPI_HOST
+#undef OLED_SPI_DMA
+#define OLED_SPI_DMA        1
+#endif
+
+// DMAC channel of the SPI transmit, the HAL owns the DMAC descriptors
+#define OLED_SPI_DMA_CHANNEL    0
+
+// Entries of the software queue of OLED_spi_WriteAsync: one on the wire and
+// one waiting, started from the DMAC interrupt when the first one is done
+#define OLED_SPI_QUEUE_SIZE     2
+
+// Pixels of the pattern a DMAC fill repeats, one interrupt per pattern
+#ifndef OLED_SPI_PATTERN_PIXELS
+#define OLED_SPI_PATTERN_PIXELS 32
+#endif
 
+#ifdef OLED_SPI_HOST
+// Host build: the pins are no-ops and the bytes go to OLED_spi_host_write,
+// provided by the host program, when a transfer completes. An asynchronous
+// transfer completes on OLED_spi_host_complete or on the next wait, so a
+// buffer reused too early shows up in the output.
+#define OLED_rw_low()
+#define OLED_enable_high()
+#define OLED_reset_low()
+#define OLED_reset_high()
+#define OLED_dc_low()       OLED_spi_host_dc(false)
+#define OLED_dc_high()      OLED_spi_host_dc(true)
+#define OLED_cs_low()       OLED_spi_host_cs(false)
+#define OLED_cs_high()      OLED_spi_host_cs(true)
+#define OLED_delay_ms(ms)
+#else
 #define OLED_rw_low         AN2_Clear
 #define OLED_enable_high    INT2_Set
 #define OLED_reset_low      RST2_Clear
@@ -29,6 +73,9 @@
 #define OLED_cs_low         CS2_Clear
 #define OLED_cs_high        CS2_Set
 #define OLED_delay_ms       SYSTICK_DelayMs
+#endif
+
+typedef void (*OLED_SPI_CALLBACK)(uintptr_t context);
 
 
 /* Provide C++ Compatibility */
@@ -36,10 +83,14 @@
 extern "C" {
 #endif
 
-void OLED_comm_open();
+/*!
+ *  @brief This API sets up the DMAC channel of the SPI transmit.
+ */
+void OLED_comm_open(void);
 
 /*!
  *  @brief This API sends a byte of data through SPI
+ *  It waits for the asynchronous transfers and returns when the byte is out.
  *
  *  @param[in] byte : Data to be sent
  */
@@ -47,16 +98,83 @@ void OLED_spi_byteWrite(uint8_t byte);
 
 /*!
  *  @brief This API sends a data through SPI
+ *  It waits for the asynchronous transfers and returns when the data is out.
  *
  *  @param[in] byte : Data to be sent
  *  @param[in] len : Length of the data
  */
 void OLED_spi_Write(uint8_t *data, size_t len);
 
+/*!
+ *  @brief This API starts sending data through SPI and returns.
+ *  The data is sent by the DMAC after the transfers already queued, each
+ *  one started by the interrupt of the one before it. The
+ *  buffer must not be changed until the callback is called, which happens
+ *  from the DMAC interrupt once the last byte is read from the buffer. The
+ *  last bytes may still be shifting out then: call OLED_spi_wait before
+ *  changing the D/C or CS pins. When the queue is full the call waits for
+ *  a free slot. Without OLED_SPI_DMA the data is sent before returning.
+ *
+ *  @param[in] *data : Data to be sent
+ *  @param[in] len : Length of the data, up to 65535 bytes
+ *  @param[in] callback : Function called when the buffer is free, or NULL
+ *  @param[in] context : Value passed to the callback
+ *
+ *  @return false if len is 0 or too long
+ */
+bool OLED_spi_WriteAsync(uint8_t *data, size_t len, OLED_SPI_CALLBACK callback, uintptr_t context);
+
+/*!
+ *  @brief This API sends a 16-bit pattern count times through SPI.
+ *  It waits for the asynchronous transfers and feeds the SPI data register
+ *  directly, high byte first.
+ *
+ *  @param[in] pattern : Pattern to be sent, i.e. a RGB565 color
+ *  @param[in] count : Times the pattern is sent
+ */
+void OLED_spi_Fill(uint16_t pattern, size_t count);
+
+/*!
+ *  @brief This API starts sending a 16-bit pattern count times and returns.
+ *  When both bytes of the pattern are equal the DMAC reads the same byte
+ *  for the whole fill, otherwise it repeats OLED_SPI_PATTERN_PIXELS copies
+ *  of the pattern with one interrupt each. The same rules as for
+ *  OLED_spi_WriteAsync apply.
+ *
+ *  @param[in] pattern : Pattern to be sent, i.e. a RGB565 color
+ *  @param[in] count : Times the pattern is sent
+ *  @param[in] callback : Function called when the fill is done, or NULL
+ *  @param[in] context : Value passed to the callback
+ *
+ *  @return false if count is 0
+ */
+bool OLED_spi_FillAsync(uint16_t pattern, size_t count, OLED_SPI_CALLBACK callback, uintptr_t context);
+
+/*!
+ *  @brief This API waits until all the data is sent through SPI.
+ */
+void OLED_spi_wait(void);
+
+/*!
+ *  @brief This API waits until at most pending asynchronous transfers are
+ *  left in the queue. With two buffers used in turn, waiting for 1 pending
+ *  transfer frees the buffer sent before the last one.
+ *
+ *  @param[in] pending : Transfers that may still be queued
+ */
+void OLED_spi_wait_pending(uint8_t pending);
+
 /*!
  *  @brief This API checks if data is still sent through SPI
  */
-bool OLED_spi_is_transmitter_busy();
+bool OLED_spi_is_transmitter_busy(void);
+
+#ifdef OLED_SPI_HOST
+void OLED_spi_host_write(const uint8_t *data, size_t len);
+void OLED_spi_host_dc(bool high);
+void OLED_spi_host_cs(bool high);
+void OLED_spi_host_complete(void);
+#endif
 
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
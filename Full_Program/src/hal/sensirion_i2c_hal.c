@@ -31,6 +31,7 @@
 
 #include "sensirion_i2c_hal.h"
 #include "sensirion/sensirion_common.h"
+#include "i2c_queue.h"
 
 /*
  * INSTRUCTIONS
@@ -62,7 +63,7 @@ int16_t sensirion_i2c_hal_select_bus(uint8_t bus_idx) {
  * communication.
  */
 void sensirion_i2c_hal_init(void) {
-    /* TODO:IMPLEMENT */
+    I2C_queue_init();
 }
 
 /**
@@ -83,8 +84,12 @@ void sensirion_i2c_hal_free(void) {
  * @returns 0 on success, error code otherwise
  */
 int8_t sensirion_i2c_hal_read(uint8_t address, uint8_t* data, uint16_t count) {
-    if (SENSIRION_I2C_Read(address, data, count)) {
-        while (SENSIRION_I2C_IsBusy()) {   }
+    I2C_transaction transaction;
+
+    // queued behind the transactions of other drivers, if any
+    I2C_queue_read(&transaction, address, data, count);
+    transaction.retries = SENSIRION_I2C_RETRIES;
+    if (I2C_queue_submit(&transaction) && I2C_queue_wait(&transaction)) {
         return NO_ERROR;
     } else {
         return 1;
@@ -103,8 +108,11 @@ int8_t sensirion_i2c_hal_read(uint8_t address, uint8_t* data, uint16_t count) {
  * @returns 0 on success, error code otherwise
  */
 int8_t sensirion_i2c_hal_write(uint8_t address, const uint8_t* data, uint16_t count) {
-    if (SENSIRION_I2C_WRITE(address, (uint8_t*)data, count)) {
-        while (SENSIRION_I2C_IsBusy()) {   }
+    I2C_transaction transaction;
+
+    I2C_queue_write(&transaction, address, (uint8_t*)data, count);
+    transaction.retries = SENSIRION_I2C_RETRIES;
+    if (I2C_queue_submit(&transaction) && I2C_queue_wait(&transaction)) {
         return NO_ERROR;
     } else {
         return 1; // ERROR
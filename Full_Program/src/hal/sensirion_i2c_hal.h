@@ -36,14 +36,14 @@
 #include "definitions.h"
 #include "sensirion/sensirion_api.h"
 
-// I2C Definitions
-#define SENSIRION_I2C_WRITE                 SERCOM2_I2C_Write
-#define SENSIRION_I2C_IsBusy                SERCOM2_I2C_IsBusy
-#define SENSIRION_I2C_Read                  SERCOM2_I2C_Read
-
+// The I2C transfers go through the queue of hal/i2c_queue.h
+// A SCD4x NAKs its address while it executes a command, the transfer is
+// tried again after 2, 4 and 8 ms
+#define SENSIRION_I2C_RETRIES               3
 // Timer Definitions
 #define SENSIRION_TimerStart    			SYSTICK_TimerStart
 #define SENSIRION_DelayMs                   SYSTICK_DelayMs
+#define SENSIRION_GetTicks                  SYSTICK_GetTickCounter
 
 #define SENSIRION_TERMINAL_Write            SERCOM5_USART_Write
 #define SENSIRION_TERMINAL_Done             SERCOM5_USART_TransmitComplete       
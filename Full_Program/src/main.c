@@ -28,6 +28,7 @@
 #include "definitions.h"                // SYS function prototypes
 
 #include "tasks.h"
+#include "timer_wheel.h"
 #include "app.h"
 #include "sensirion/sensirion_api.h"
 
@@ -54,15 +55,16 @@ int main ( void )
     print_header();
     init_modules();
     
-    Task_register(0, 2000, sensirion_read_data);
-    Task_register(0, 5000, print_oled_data);    
-    Task_register(0, 500, toggle_led);   
+    // the application tasks are declared in tasks_config.h, spread their
+    // releases so they do not all run on the same tick
+    Task_plan();
 
     while ( true )
     {   
         Task_execute();
-        execute_button_task();
+        Timer_execute();
         handle_USART_cmd();
+        Task_idle();
     }
 
     return ( EXIT_FAILURE );
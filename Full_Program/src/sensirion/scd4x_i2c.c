@@ -41,8 +41,6 @@
 #include "sensirion_i2c.h"
 #include "hal/sensirion_i2c_hal.h"
 
-#define SCD4X_I2C_ADDRESS 98
-
 int16_t scd4x_start_periodic_measurement() {
     int16_t error;
     uint8_t buffer[2];
@@ -60,34 +58,57 @@ int16_t scd4x_start_periodic_measurement() {
 int16_t scd4x_read_measurement_ticks(uint16_t* co2, uint16_t* temperature,
                                      uint16_t* humidity) {
     int16_t error;
-    uint8_t buffer[9];
-    uint16_t offset = 0;
-    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0xEC05);
 
-    error = sensirion_i2c_write_data(SCD4X_I2C_ADDRESS, &buffer[0], offset);
+    error = scd4x_read_measurement_start();
     if (error) {
         return error;
     }
 
-    sensirion_i2c_hal_sleep_usec(1000);
+    sensirion_i2c_hal_sleep_usec(SCD4X_COMMAND_DELAY_US);
+
+    return scd4x_read_measurement_ticks_fetch(co2, temperature, humidity);
+}
+
+int16_t scd4x_read_measurement_start(void) {
+    uint8_t buffer[2];
+    uint16_t offset = 0;
+    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0xEC05);
+
+    return sensirion_i2c_write_data(SCD4X_I2C_ADDRESS, &buffer[0], offset);
+}
+
+int16_t scd4x_read_measurement_ticks_fetch(uint16_t* co2,
+                                           uint16_t* temperature,
+                                           uint16_t* humidity) {
+    uint16_t* const words[] = {co2, temperature, humidity};
+    uint8_t buffer[9];
+
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 3);
+}
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 6);
+int16_t scd4x_read_measurement(uint16_t* co2, int32_t* temperature_m_deg_c,
+                               int32_t* humidity_m_percent_rh) {
+    int16_t error;
+    uint16_t temperature;
+    uint16_t humidity;
+
+    error = scd4x_read_measurement_ticks(co2, &temperature, &humidity);
     if (error) {
         return error;
     }
-    *co2 = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    *temperature = sensirion_common_bytes_to_uint16_t(&buffer[2]);
-    *humidity = sensirion_common_bytes_to_uint16_t(&buffer[4]);
+    *temperature_m_deg_c = ((21875 * (int32_t)temperature) >> 13) - 45000;
+    *humidity_m_percent_rh = ((12500 * (int32_t)humidity) >> 13);
     return NO_ERROR;
 }
 
-int16_t scd4x_read_measurement(uint16_t* co2, int32_t* temperature_m_deg_c,
-                               int32_t* humidity_m_percent_rh) {
+int16_t scd4x_read_measurement_fetch(uint16_t* co2,
+                                     int32_t* temperature_m_deg_c,
+                                     int32_t* humidity_m_percent_rh) {
     int16_t error;
     uint16_t temperature;
     uint16_t humidity;
 
-    error = scd4x_read_measurement_ticks(co2, &temperature, &humidity);
+    error = scd4x_read_measurement_ticks_fetch(co2, &temperature, &humidity);
     if (error) {
         return error;
     }
@@ -112,6 +133,7 @@ int16_t scd4x_stop_periodic_measurement() {
 
 int16_t scd4x_get_temperature_offset_ticks(uint16_t* t_offset) {
     int16_t error;
+    uint16_t* const words[] = {t_offset};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x2318);
@@ -123,12 +145,7 @@ int16_t scd4x_get_temperature_offset_ticks(uint16_t* t_offset) {
 
     sensirion_i2c_hal_sleep_usec(1000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *t_offset = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t scd4x_get_temperature_offset(int32_t* t_offset_m_deg_c) {
@@ -166,6 +183,7 @@ int16_t scd4x_set_temperature_offset(int32_t t_offset_m_deg_c) {
 
 int16_t scd4x_get_sensor_altitude(uint16_t* sensor_altitude) {
     int16_t error;
+    uint16_t* const words[] = {sensor_altitude};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x2322);
@@ -177,12 +195,7 @@ int16_t scd4x_get_sensor_altitude(uint16_t* sensor_altitude) {
 
     sensirion_i2c_hal_sleep_usec(1000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *sensor_altitude = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t scd4x_set_sensor_altitude(uint16_t sensor_altitude) {
@@ -222,6 +235,7 @@ int16_t scd4x_set_ambient_pressure(uint16_t ambient_pressure) {
 int16_t scd4x_perform_forced_recalibration(uint16_t target_co2_concentration,
                                            uint16_t* frc_correction) {
     int16_t error;
+    uint16_t* const words[] = {frc_correction};
     uint8_t buffer[5];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x362F);
@@ -236,16 +250,12 @@ int16_t scd4x_perform_forced_recalibration(uint16_t target_co2_concentration,
 
     sensirion_i2c_hal_sleep_usec(400000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *frc_correction = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t scd4x_get_automatic_self_calibration(uint16_t* asc_enabled) {
     int16_t error;
+    uint16_t* const words[] = {asc_enabled};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x2313);
@@ -257,12 +267,7 @@ int16_t scd4x_get_automatic_self_calibration(uint16_t* asc_enabled) {
 
     sensirion_i2c_hal_sleep_usec(1000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *asc_enabled = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t scd4x_set_automatic_self_calibration(uint16_t asc_enabled) {
@@ -292,23 +297,35 @@ int16_t scd4x_start_low_power_periodic_measurement() {
 
 int16_t scd4x_get_data_ready_flag(bool* data_ready_flag) {
     int16_t error;
-    uint8_t buffer[3];
-    uint16_t offset = 0;
-    uint16_t local_data_ready = 0;
-    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0xE4B8);
 
-    error = sensirion_i2c_write_data(SCD4X_I2C_ADDRESS, &buffer[0], offset);
+    error = scd4x_get_data_ready_flag_start();
     if (error) {
         return error;
     }
 
-    sensirion_i2c_hal_sleep_usec(1000);
+    sensirion_i2c_hal_sleep_usec(SCD4X_COMMAND_DELAY_US);
+
+    return scd4x_get_data_ready_flag_fetch(data_ready_flag);
+}
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
+int16_t scd4x_get_data_ready_flag_start(void) {
+    uint8_t buffer[2];
+    uint16_t offset = 0;
+    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0xE4B8);
+
+    return sensirion_i2c_write_data(SCD4X_I2C_ADDRESS, &buffer[0], offset);
+}
+
+int16_t scd4x_get_data_ready_flag_fetch(bool* data_ready_flag) {
+    int16_t error;
+    uint16_t local_data_ready = 0;
+    uint16_t* const words[] = {&local_data_ready};
+    uint8_t buffer[3];
+
+    error = sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
     if (error) {
         return error;
     }
-    local_data_ready = sensirion_common_bytes_to_uint16_t(&buffer[0]);
     *data_ready_flag = (local_data_ready & 0x07FF) != 0;
     return NO_ERROR;
 }
@@ -330,6 +347,7 @@ int16_t scd4x_persist_settings() {
 int16_t scd4x_get_serial_number(uint16_t* serial_0, uint16_t* serial_1,
                                 uint16_t* serial_2) {
     int16_t error;
+    uint16_t* const words[] = {serial_0, serial_1, serial_2};
     uint8_t buffer[9];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x3682);
@@ -341,18 +359,12 @@ int16_t scd4x_get_serial_number(uint16_t* serial_0, uint16_t* serial_1,
 
     sensirion_i2c_hal_sleep_usec(1000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 6);
-    if (error) {
-        return error;
-    }
-    *serial_0 = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    *serial_1 = sensirion_common_bytes_to_uint16_t(&buffer[2]);
-    *serial_2 = sensirion_common_bytes_to_uint16_t(&buffer[4]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 3);
 }
 
 int16_t scd4x_perform_self_test(uint16_t* sensor_status) {
     int16_t error;
+    uint16_t* const words[] = {sensor_status};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x3639);
@@ -364,12 +376,7 @@ int16_t scd4x_perform_self_test(uint16_t* sensor_status) {
 
     sensirion_i2c_hal_sleep_usec(10000000);
 
-    error = sensirion_i2c_read_data_inplace(SCD4X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *sensor_status = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SCD4X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t scd4x_perform_factory_reset() {
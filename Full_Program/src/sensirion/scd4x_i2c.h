@@ -39,6 +39,11 @@
 #ifndef SCD4X_I2C_H
 #define SCD4X_I2C_H
 
+#define SCD4X_I2C_ADDRESS 98
+
+/* Time the sensor needs to prepare the answer to a read command */
+#define SCD4X_COMMAND_DELAY_US 1000
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -95,6 +100,36 @@ int16_t scd4x_read_measurement_ticks(uint16_t* co2, uint16_t* temperature,
 int16_t scd4x_read_measurement(uint16_t* co2, int32_t* temperature_m_deg_c,
                                int32_t* humidity_m_percent_rh);
 
+/**
+ * scd4x_read_measurement_start() - First half of scd4x_read_measurement():
+ * sends the read command only. Fetch the result with
+ * scd4x_read_measurement_fetch() or scd4x_read_measurement_ticks_fetch()
+ * after at least SCD4X_COMMAND_DELAY_US.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t scd4x_read_measurement_start(void);
+
+/**
+ * scd4x_read_measurement_ticks_fetch() - Second half of
+ * scd4x_read_measurement_ticks(), see there for the parameters.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t scd4x_read_measurement_ticks_fetch(uint16_t* co2,
+                                           uint16_t* temperature,
+                                           uint16_t* humidity);
+
+/**
+ * scd4x_read_measurement_fetch() - Second half of scd4x_read_measurement(),
+ * see there for the parameters.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t scd4x_read_measurement_fetch(uint16_t* co2,
+                                     int32_t* temperature_m_deg_c,
+                                     int32_t* humidity_m_percent_rh);
+
 /**
  * scd4x_stop_periodic_measurement() - Stop periodic measurement and return to
  * idle mode for sensor configuration or to safe energy.
@@ -265,6 +300,25 @@ int16_t scd4x_start_low_power_periodic_measurement(void);
  */
 int16_t scd4x_get_data_ready_flag(bool* data_ready_flag);
 
+/**
+ * scd4x_get_data_ready_flag_start() - First half of
+ * scd4x_get_data_ready_flag(): sends the command only. Fetch the flag with
+ * scd4x_get_data_ready_flag_fetch() after at least SCD4X_COMMAND_DELAY_US.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t scd4x_get_data_ready_flag_start(void);
+
+/**
+ * scd4x_get_data_ready_flag_fetch() - Second half of
+ * scd4x_get_data_ready_flag().
+ *
+ * @param data_ready_flag True if data available, otherwise false.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t scd4x_get_data_ready_flag_fetch(bool* data_ready_flag);
+
 /**
  * scd4x_persist_settings() - Configuration settings such as the temperature
  * offset, sensor altitude and the ASC enabled/disabled parameter are by default
@@ -41,8 +41,6 @@
 #include "sensirion_i2c.h"
 #include "hal/sensirion_i2c_hal.h"
 
-#define SEN5X_I2C_ADDRESS 0x69
-
 int16_t sen5x_start_measurement(void) {
     int16_t error;
     uint8_t buffer[2];
@@ -87,6 +85,8 @@ int16_t sen5x_stop_measurement(void) {
 
 int16_t sen5x_read_data_ready(bool* data_ready) {
     int16_t error;
+    uint16_t local_data_ready;
+    uint16_t* const words[] = {&local_data_ready};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x202);
@@ -98,11 +98,11 @@ int16_t sen5x_read_data_ready(bool* data_ready) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 2);
+    error = sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 1);
     if (error) {
         return error;
     }
-    *data_ready = buffer[1];
+    *data_ready = (uint8_t)local_data_ready;
     return NO_ERROR;
 }
 
@@ -114,36 +114,52 @@ int16_t sen5x_read_measured_values(uint16_t* mass_concentration_pm1p0,
                                    int16_t* ambient_temperature,
                                    int16_t* voc_index, int16_t* nox_index) {
     int16_t error;
-    uint8_t buffer[24];
-    uint16_t offset = 0;
-    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x3C4);
 
-    error = sensirion_i2c_write_data(SEN5X_I2C_ADDRESS, &buffer[0], offset);
+    error = sen5x_read_measured_values_start();
     if (error) {
         return error;
     }
 
-    sensirion_i2c_hal_sleep_usec(20000);
+    sensirion_i2c_hal_sleep_usec(SEN5X_READ_MEASURED_VALUES_DELAY_US);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 16);
-    if (error) {
-        return error;
-    }
-    *mass_concentration_pm1p0 = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    *mass_concentration_pm2p5 = sensirion_common_bytes_to_uint16_t(&buffer[2]);
-    *mass_concentration_pm4p0 = sensirion_common_bytes_to_uint16_t(&buffer[4]);
-    *mass_concentration_pm10p0 = sensirion_common_bytes_to_uint16_t(&buffer[6]);
-    *ambient_humidity = sensirion_common_bytes_to_int16_t(&buffer[8]);
-    *ambient_temperature = sensirion_common_bytes_to_int16_t(&buffer[10]);
-    *voc_index = sensirion_common_bytes_to_int16_t(&buffer[12]);
-    *nox_index = sensirion_common_bytes_to_int16_t(&buffer[14]);
-    return NO_ERROR;
+    return sen5x_read_measured_values_fetch(
+        mass_concentration_pm1p0, mass_concentration_pm2p5,
+        mass_concentration_pm4p0, mass_concentration_pm10p0, ambient_humidity,
+        ambient_temperature, voc_index, nox_index);
+}
+
+int16_t sen5x_read_measured_values_start(void) {
+    uint8_t buffer[2];
+    uint16_t offset = 0;
+    offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x3C4);
+
+    return sensirion_i2c_write_data(SEN5X_I2C_ADDRESS, &buffer[0], offset);
+}
+
+int16_t sen5x_read_measured_values_fetch(uint16_t* mass_concentration_pm1p0,
+                                         uint16_t* mass_concentration_pm2p5,
+                                         uint16_t* mass_concentration_pm4p0,
+                                         uint16_t* mass_concentration_pm10p0,
+                                         int16_t* ambient_humidity,
+                                         int16_t* ambient_temperature,
+                                         int16_t* voc_index,
+                                         int16_t* nox_index) {
+    uint16_t* const words[] = {
+        mass_concentration_pm1p0, mass_concentration_pm2p5,
+        mass_concentration_pm4p0, mass_concentration_pm10p0,
+        (uint16_t*)ambient_humidity, (uint16_t*)ambient_temperature,
+        (uint16_t*)voc_index, (uint16_t*)nox_index};
+    uint8_t buffer[24];
+
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 8);
 }
 
 int16_t sen5x_read_measured_raw_values(int16_t* raw_humidity,
                                        int16_t* raw_temperature,
                                        uint16_t* raw_voc, uint16_t* raw_nox) {
     int16_t error;
+    uint16_t* const words[] = {
+        (uint16_t*)raw_humidity, (uint16_t*)raw_temperature, raw_voc, raw_nox};
     uint8_t buffer[12];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x3D2);
@@ -155,15 +171,7 @@ int16_t sen5x_read_measured_raw_values(int16_t* raw_humidity,
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 8);
-    if (error) {
-        return error;
-    }
-    *raw_humidity = sensirion_common_bytes_to_int16_t(&buffer[0]);
-    *raw_temperature = sensirion_common_bytes_to_int16_t(&buffer[2]);
-    *raw_voc = sensirion_common_bytes_to_uint16_t(&buffer[4]);
-    *raw_nox = sensirion_common_bytes_to_uint16_t(&buffer[6]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 4);
 }
 
 int16_t sen5x_read_measured_values_sen50(uint16_t* mass_concentration_pm1p0,
@@ -193,6 +201,12 @@ int16_t sen5x_read_measured_pm_values(
     uint16_t* number_concentration_pm2p5, uint16_t* number_concentration_pm4p0,
     uint16_t* number_concentration_pm10p0, uint16_t* typical_particle_size) {
     int16_t error;
+    uint16_t* const words[] = {
+        mass_concentration_pm1p0, mass_concentration_pm2p5,
+        mass_concentration_pm4p0, mass_concentration_pm10p0,
+        number_concentration_pm0p5, number_concentration_pm1p0,
+        number_concentration_pm2p5, number_concentration_pm4p0,
+        number_concentration_pm10p0, typical_particle_size};
     uint8_t buffer[30];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x413);
@@ -204,26 +218,7 @@ int16_t sen5x_read_measured_pm_values(
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 20);
-    if (error) {
-        return error;
-    }
-    *mass_concentration_pm1p0 = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    *mass_concentration_pm2p5 = sensirion_common_bytes_to_uint16_t(&buffer[2]);
-    *mass_concentration_pm4p0 = sensirion_common_bytes_to_uint16_t(&buffer[4]);
-    *mass_concentration_pm10p0 = sensirion_common_bytes_to_uint16_t(&buffer[6]);
-    *number_concentration_pm0p5 =
-        sensirion_common_bytes_to_uint16_t(&buffer[8]);
-    *number_concentration_pm1p0 =
-        sensirion_common_bytes_to_uint16_t(&buffer[10]);
-    *number_concentration_pm2p5 =
-        sensirion_common_bytes_to_uint16_t(&buffer[12]);
-    *number_concentration_pm4p0 =
-        sensirion_common_bytes_to_uint16_t(&buffer[14]);
-    *number_concentration_pm10p0 =
-        sensirion_common_bytes_to_uint16_t(&buffer[16]);
-    *typical_particle_size = sensirion_common_bytes_to_uint16_t(&buffer[18]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 10);
 }
 
 int16_t sen5x_start_fan_cleaning(void) {
@@ -266,6 +261,8 @@ int16_t sen5x_get_temperature_offset_parameters(int16_t* temp_offset,
                                                 int16_t* slope,
                                                 uint16_t* time_constant) {
     int16_t error;
+    uint16_t* const words[] = {
+        (uint16_t*)temp_offset, (uint16_t*)slope, time_constant};
     uint8_t buffer[9];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x60B2);
@@ -277,14 +274,7 @@ int16_t sen5x_get_temperature_offset_parameters(int16_t* temp_offset,
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 6);
-    if (error) {
-        return error;
-    }
-    *temp_offset = sensirion_common_bytes_to_int16_t(&buffer[0]);
-    *slope = sensirion_common_bytes_to_int16_t(&buffer[2]);
-    *time_constant = sensirion_common_bytes_to_uint16_t(&buffer[4]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 3);
 }
 
 int16_t sen5x_set_warm_start_parameter(uint16_t warm_start) {
@@ -306,6 +296,7 @@ int16_t sen5x_set_warm_start_parameter(uint16_t warm_start) {
 
 int16_t sen5x_get_warm_start_parameter(uint16_t* warm_start) {
     int16_t error;
+    uint16_t* const words[] = {warm_start};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x60C6);
@@ -317,12 +308,7 @@ int16_t sen5x_get_warm_start_parameter(uint16_t* warm_start) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *warm_start = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t sen5x_set_voc_algorithm_tuning_parameters(
@@ -360,6 +346,11 @@ int16_t sen5x_get_voc_algorithm_tuning_parameters(
     int16_t* learning_time_gain_hours, int16_t* gating_max_duration_minutes,
     int16_t* std_initial, int16_t* gain_factor) {
     int16_t error;
+    uint16_t* const words[] = {
+        (uint16_t*)index_offset, (uint16_t*)learning_time_offset_hours,
+        (uint16_t*)learning_time_gain_hours,
+        (uint16_t*)gating_max_duration_minutes, (uint16_t*)std_initial,
+        (uint16_t*)gain_factor};
     uint8_t buffer[18];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x60D0);
@@ -371,18 +362,7 @@ int16_t sen5x_get_voc_algorithm_tuning_parameters(
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 12);
-    if (error) {
-        return error;
-    }
-    *index_offset = sensirion_common_bytes_to_int16_t(&buffer[0]);
-    *learning_time_offset_hours = sensirion_common_bytes_to_int16_t(&buffer[2]);
-    *learning_time_gain_hours = sensirion_common_bytes_to_int16_t(&buffer[4]);
-    *gating_max_duration_minutes =
-        sensirion_common_bytes_to_int16_t(&buffer[6]);
-    *std_initial = sensirion_common_bytes_to_int16_t(&buffer[8]);
-    *gain_factor = sensirion_common_bytes_to_int16_t(&buffer[10]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 6);
 }
 
 int16_t sen5x_set_nox_algorithm_tuning_parameters(
@@ -420,6 +400,11 @@ int16_t sen5x_get_nox_algorithm_tuning_parameters(
     int16_t* learning_time_gain_hours, int16_t* gating_max_duration_minutes,
     int16_t* std_initial, int16_t* gain_factor) {
     int16_t error;
+    uint16_t* const words[] = {
+        (uint16_t*)index_offset, (uint16_t*)learning_time_offset_hours,
+        (uint16_t*)learning_time_gain_hours,
+        (uint16_t*)gating_max_duration_minutes, (uint16_t*)std_initial,
+        (uint16_t*)gain_factor};
     uint8_t buffer[18];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x60E1);
@@ -431,18 +416,7 @@ int16_t sen5x_get_nox_algorithm_tuning_parameters(
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 12);
-    if (error) {
-        return error;
-    }
-    *index_offset = sensirion_common_bytes_to_int16_t(&buffer[0]);
-    *learning_time_offset_hours = sensirion_common_bytes_to_int16_t(&buffer[2]);
-    *learning_time_gain_hours = sensirion_common_bytes_to_int16_t(&buffer[4]);
-    *gating_max_duration_minutes =
-        sensirion_common_bytes_to_int16_t(&buffer[6]);
-    *std_initial = sensirion_common_bytes_to_int16_t(&buffer[8]);
-    *gain_factor = sensirion_common_bytes_to_int16_t(&buffer[10]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 6);
 }
 
 int16_t sen5x_set_rht_acceleration_mode(uint16_t mode) {
@@ -463,6 +437,7 @@ int16_t sen5x_set_rht_acceleration_mode(uint16_t mode) {
 
 int16_t sen5x_get_rht_acceleration_mode(uint16_t* mode) {
     int16_t error;
+    uint16_t* const words[] = {mode};
     uint8_t buffer[3];
     uint16_t offset = 0;
     offset = sensirion_i2c_add_command_to_buffer(&buffer[0], offset, 0x60F7);
@@ -474,12 +449,7 @@ int16_t sen5x_get_rht_acceleration_mode(uint16_t* mode) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 2);
-    if (error) {
-        return error;
-    }
-    *mode = sensirion_common_bytes_to_uint16_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_values(SEN5X_I2C_ADDRESS, &buffer[0], words, 1);
 }
 
 int16_t sen5x_set_voc_algorithm_state(const uint8_t* state,
@@ -550,12 +520,8 @@ int16_t sen5x_get_fan_auto_cleaning_interval(uint32_t* interval) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 4);
-    if (error) {
-        return error;
-    }
-    *interval = sensirion_common_bytes_to_uint32_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_frame(SEN5X_I2C_ADDRESS, &buffer[0],
+                                    &sensirion_i2c_uint32_field, 1, interval);
 }
 
 int16_t sen5x_get_product_name(unsigned char* product_name,
@@ -645,12 +611,9 @@ int16_t sen5x_read_device_status(uint32_t* device_status) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 4);
-    if (error) {
-        return error;
-    }
-    *device_status = sensirion_common_bytes_to_uint32_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_frame(SEN5X_I2C_ADDRESS, &buffer[0],
+                                    &sensirion_i2c_uint32_field, 1,
+                                    device_status);
 }
 
 int16_t sen5x_read_and_clear_device_status(uint32_t* device_status) {
@@ -666,12 +629,9 @@ int16_t sen5x_read_and_clear_device_status(uint32_t* device_status) {
 
     sensirion_i2c_hal_sleep_usec(20000);
 
-    error = sensirion_i2c_read_data_inplace(SEN5X_I2C_ADDRESS, &buffer[0], 4);
-    if (error) {
-        return error;
-    }
-    *device_status = sensirion_common_bytes_to_uint32_t(&buffer[0]);
-    return NO_ERROR;
+    return sensirion_i2c_read_frame(SEN5X_I2C_ADDRESS, &buffer[0],
+                                    &sensirion_i2c_uint32_field, 1,
+                                    device_status);
 }
 
 int16_t sen5x_device_reset(void) {
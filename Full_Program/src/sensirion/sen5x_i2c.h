@@ -39,6 +39,11 @@
 #ifndef SEN5X_I2C_H
 #define SEN5X_I2C_H
 
+#define SEN5X_I2C_ADDRESS 0x69
+
+/* Time the sensor needs to prepare the measured values */
+#define SEN5X_READ_MEASURED_VALUES_DELAY_US 20000
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -157,6 +162,32 @@ int16_t sen5x_read_measured_values(uint16_t* mass_concentration_pm1p0,
                                    int16_t* ambient_temperature,
                                    int16_t* voc_index, int16_t* nox_index);
 
+/**
+ * sen5x_read_measured_values_start() - First half of
+ * sen5x_read_measured_values(): sends the read command only. Call
+ * sen5x_read_measured_values_fetch() after at least
+ * SEN5X_READ_MEASURED_VALUES_DELAY_US to get the values, so the caller can do
+ * other work while the sensor prepares the answer.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t sen5x_read_measured_values_start(void);
+
+/**
+ * sen5x_read_measured_values_fetch() - Second half of
+ * sen5x_read_measured_values(), see there for the parameters.
+ *
+ * @return 0 on success, an error code otherwise
+ */
+int16_t sen5x_read_measured_values_fetch(uint16_t* mass_concentration_pm1p0,
+                                         uint16_t* mass_concentration_pm2p5,
+                                         uint16_t* mass_concentration_pm4p0,
+                                         uint16_t* mass_concentration_pm10p0,
+                                         int16_t* ambient_humidity,
+                                         int16_t* ambient_temperature,
+                                         int16_t* voc_index,
+                                         int16_t* nox_index);
+
 /**
  * sen5x_read_measured_raw_values() - Returns the measured raw values.
 
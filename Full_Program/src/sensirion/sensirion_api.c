@@ -50,6 +50,8 @@
 #include "scd4x_i2c.h"
 #include "sen5x_i2c.h"
 #include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "tasks.h"
 
 #include <string.h>                     // string lib functions
 #include <stdio.h>                      // sprintf function
@@ -62,6 +64,28 @@ bool sensirion_debug = true;
 char buffer[200];
 char scd4_serial[13];
 
+// Fields of the measurement frames, decoded straight into sensor_data.
+// The SEN5x sends the temperature in 1/200 C, kept in 1/100 C; the SCD4x
+// sends ticks, converted to milli degrees and milli %RH as scd4x_read_measurement does.
+static const sensirion_i2c_field sen5x_measured_values[] = {
+    SENSIRION_FIELD(UINT16, sensirion_sen5x_data, mass_concentration_pm1p0),
+    SENSIRION_FIELD(UINT16, sensirion_sen5x_data, mass_concentration_pm2p5),
+    SENSIRION_FIELD(UINT16, sensirion_sen5x_data, mass_concentration_pm4p0),
+    SENSIRION_FIELD(UINT16, sensirion_sen5x_data, mass_concentration_pm10p0),
+    SENSIRION_FIELD(INT16, sensirion_sen5x_data, humidity),
+    SENSIRION_FIELD_SCALED(INT16, sensirion_sen5x_data, temperature, 1, 1, 0),
+    SENSIRION_FIELD(INT16, sensirion_sen5x_data, voc_index),
+    SENSIRION_FIELD(INT16, sensirion_sen5x_data, nox_index),
+};
+
+static const sensirion_i2c_field scd4x_measurement[] = {
+    SENSIRION_FIELD(UINT16, sensirion_scd4x_data, co2),
+    SENSIRION_FIELD_SCALED(TICKS, sensirion_scd4x_data, temperature, 21875, 13, -45000),
+    SENSIRION_FIELD_SCALED(TICKS, sensirion_scd4x_data, humidity, 12500, 13, 0),
+};
+
+#define SENSIRION_FRAME_FIELDS(fields)  (sizeof(fields) / sizeof(fields[0]))
+
 void sensirion_print_message(void)
 {
     if(sensirion_debug)
@@ -100,8 +124,69 @@ void sensirion_init(void)
 
 void sensirion_read_data(void)
 {
-    sensirion_scd4x_read_data();
-    sensirion_sen5x_read_data();
+    // runs as a coroutine task: the sensor conversion times are spent in the
+    // scheduler instead of SENSIRION_DelayMs, so the main loop keeps running.
+    // The SEN5x takes 20 ms to answer a read command, the whole SCD4x
+    // exchange fits in that time, so the SEN5x command goes out first and
+    // its result is collected last.
+    static bool data_ready;
+    static bool updated;
+    static bool sen5_pending;
+    static uint32_t sen5_started;
+    uint32_t elapsed;
+    int16_t error;
+    uint8_t frame[24];                  // 8 words of the SEN5x with CRCs
+
+    TASK_BEGIN();
+    updated = false;
+    sen5_pending = false;
+    if(sen5_init)
+    {
+        error = sen5x_read_measured_values_start();
+        sen5_started = SENSIRION_GetTicks();
+        sen5_pending = !sensirion_handle_error(error, "Error executing sen5x_read_measured_values");
+    }
+
+    if(scd4_init)
+    {
+        error = scd4x_get_data_ready_flag_start();
+        if(!sensirion_handle_error(error, "Error executing scd4x_get_data_ready_flag"))
+        {
+            TASK_SLEEP(SCD4X_COMMAND_DELAY_US / 1000);
+            error = scd4x_get_data_ready_flag_fetch(&data_ready);
+            if(!sensirion_handle_error(error, "Error executing scd4x_get_data_ready_flag") &&
+               data_ready)
+            {
+                error = scd4x_read_measurement_start();
+                if(!sensirion_handle_error(error, "Error executing scd4x_read_measurement"))
+                {
+                    TASK_SLEEP(SCD4X_COMMAND_DELAY_US / 1000);
+                    error = sensirion_i2c_read_frame(SCD4X_I2C_ADDRESS, frame,
+                            scd4x_measurement, SENSIRION_FRAME_FIELDS(scd4x_measurement),
+                            &sensor_data.scd4x);
+                    if(!sensirion_handle_error(error, "Error executing scd4x_read_measurement"))
+                        updated = true;
+                }
+            }
+        }
+    }
+    
+    if(sen5_pending)
+    {
+        // only the part of the 20 ms the SCD4x did not use is left
+        elapsed = SENSIRION_GetTicks() - sen5_started;
+        if(elapsed < SEN5X_READ_MEASURED_VALUES_DELAY_US / 1000)
+        {
+            TASK_SLEEP(SEN5X_READ_MEASURED_VALUES_DELAY_US / 1000 - elapsed);
+        }
+        error = sensirion_i2c_read_frame(SEN5X_I2C_ADDRESS, frame,
+                sen5x_measured_values, SENSIRION_FRAME_FIELDS(sen5x_measured_values),
+                &sensor_data.sen5x);
+        if(!sensirion_handle_error(error, "Error executing sen5x_read_measured_values"))
+            updated = true;
+    }
+    if(updated) sensor_data.version++;
+    TASK_END();
 }
 
 sensirion_data* sensirion_get_data(void)
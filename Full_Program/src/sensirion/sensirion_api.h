@@ -69,6 +69,7 @@ typedef struct {
 typedef struct {
     sensirion_scd4x_data scd4x;
     sensirion_sen5x_data sen5x;
+    uint32_t version;           // incremented by each read that got new data
 } sensirion_data;
 
 /* Provide C++ Compatibility */
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include "sensirion_crc8.h"
+#include "sensirion_crc8_tables.h"
+
+uint8_t sensirion_crc8_bitwise(const uint8_t* data, uint16_t count) {
+    uint16_t current_byte;
+    uint8_t crc = CRC8_INIT;
+    uint8_t crc_bit;
+
+    /* calculates 8-Bit checksum with given polynomial */
+    for (current_byte = 0; current_byte < count; ++current_byte) {
+        crc ^= (data[current_byte]);
+        for (crc_bit = 8; crc_bit > 0; --crc_bit) {
+            if (crc & 0x80)
+                crc = (crc << 1) ^ CRC8_POLYNOMIAL;
+            else
+                crc = (crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint8_t sensirion_crc8_word_bitwise(const uint8_t* word) {
+    return sensirion_crc8_bitwise(word, SENSIRION_WORD_SIZE);
+}
+
+#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_NIBBLE || defined(SENSIRION_CRC8_ALL)
+/* the high nibble of the register picks what the next 4 shifts add */
+#define SENSIRION_CRC8_NIBBLE_STEP(crc) \
+    (uint8_t)(((crc) << 4) ^ sensirion_crc8_nibble_table[(crc) >> 4])
+
+uint8_t sensirion_crc8_nibble(const uint8_t* data, uint16_t count) {
+    uint8_t crc = CRC8_INIT;
+
+    while (count--) {
+        crc ^= *data++;
+        crc = SENSIRION_CRC8_NIBBLE_STEP(crc);
+        crc = SENSIRION_CRC8_NIBBLE_STEP(crc);
+    }
+    return crc;
+}
+
+uint8_t sensirion_crc8_word_nibble(const uint8_t* word) {
+    uint8_t crc = CRC8_INIT ^ word[0];
+
+    crc = SENSIRION_CRC8_NIBBLE_STEP(crc);
+    crc = SENSIRION_CRC8_NIBBLE_STEP(crc);
+    crc ^= word[1];
+    crc = SENSIRION_CRC8_NIBBLE_STEP(crc);
+    return SENSIRION_CRC8_NIBBLE_STEP(crc);
+}
+#endif
+
+#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_TABLE || defined(SENSIRION_CRC8_ALL)
+uint8_t sensirion_crc8_table(const uint8_t* data, uint16_t count) {
+    uint8_t crc = CRC8_INIT;
+
+    while (count--) {
+        crc = sensirion_crc8_byte_table[crc ^ *data++];
+    }
+    return crc;
+}
+
+uint8_t sensirion_crc8_word_table(const uint8_t* word) {
+    return sensirion_crc8_byte_table[sensirion_crc8_byte_table[CRC8_INIT ^ word[0]] ^
+                                     word[1]];
+}
+#endif
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  CRC-8 of the Sensirion sensors
+ *
+ *  Every 16-bit word sent to or read from a sensor is followed by its CRC-8,
+ *  polynomial 0x31 and initial value 0xFF, MSB first. SENSIRION_CRC8_IMPL
+ *  selects how it is computed:
+ *
+ *  - SENSIRION_CRC8_BITWISE: 8 shifts per byte, no table
+ *  - SENSIRION_CRC8_NIBBLE: 2 lookups per byte in a table of 16 bytes
+ *  - SENSIRION_CRC8_TABLE: 1 lookup per byte in a table of 256 bytes
+ *
+ *  The tables are generated by tools/crc8_tables.py. sensirion_crc8_word is
+ *  the unrolled form for the 2 bytes of a word, the length of all the CRCs
+ *  of the I2C protocol. With SENSIRION_CRC8_ALL defined all the forms are
+ *  built, for the host benchmark in tools/crc8_bench.
+ */
+
+#ifndef SENSIRION_CRC8_H
+#define SENSIRION_CRC8_H
+
+#include "sensirion_i2c.h"
+
+#define SENSIRION_CRC8_BITWISE  0
+#define SENSIRION_CRC8_NIBBLE   1
+#define SENSIRION_CRC8_TABLE    2
+
+#ifndef SENSIRION_CRC8_IMPL
+#define SENSIRION_CRC8_IMPL     SENSIRION_CRC8_TABLE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * sensirion_crc8_bitwise() - CRC-8 of a buffer, one bit at a time
+ *
+ * @data:   Bytes to check
+ * @count:  Number of bytes
+ *
+ * @return: The CRC-8 of the bytes
+ */
+uint8_t sensirion_crc8_bitwise(const uint8_t* data, uint16_t count);
+
+/**
+ * sensirion_crc8_word_bitwise() - CRC-8 of the SENSIRION_WORD_SIZE bytes of
+ * a word, one bit at a time
+ *
+ * @word:   The 2 bytes of the word, MSB first as on the bus
+ *
+ * @return: The CRC-8 of the word
+ */
+uint8_t sensirion_crc8_word_bitwise(const uint8_t* word);
+
+/* The same with the tables */
+#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_NIBBLE || defined(SENSIRION_CRC8_ALL)
+uint8_t sensirion_crc8_nibble(const uint8_t* data, uint16_t count);
+uint8_t sensirion_crc8_word_nibble(const uint8_t* word);
+#endif
+#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_TABLE || defined(SENSIRION_CRC8_ALL)
+uint8_t sensirion_crc8_table(const uint8_t* data, uint16_t count);
+uint8_t sensirion_crc8_word_table(const uint8_t* word);
+#endif
+
+/* The selected implementation */
+#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_TABLE
+#define sensirion_crc8          sensirion_crc8_table
+#define sensirion_crc8_word     sensirion_crc8_word_table
+#elif SENSIRION_CRC8_IMPL == SENSIRION_CRC8_NIBBLE
+#define sensirion_crc8          sensirion_crc8_nibble
+#define sensirion_crc8_word     sensirion_crc8_word_nibble
+#else
+#define sensirion_crc8          sensirion_crc8_bitwise
+#define sensirion_crc8_word     sensirion_crc8_word_bitwise
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_CRC8_H */
@@ -33,28 +33,18 @@
 #include "sensirion_common.h"
 #include "sensirion_config.h"
 #include "hal/sensirion_i2c_hal.h"
+#include "sensirion_crc8.h"
 
 uint8_t sensirion_i2c_generate_crc(const uint8_t* data, uint16_t count) {
-    uint16_t current_byte;
-    uint8_t crc = CRC8_INIT;
-    uint8_t crc_bit;
-
-    /* calculates 8-Bit checksum with given polynomial */
-    for (current_byte = 0; current_byte < count; ++current_byte) {
-        crc ^= (data[current_byte]);
-        for (crc_bit = 8; crc_bit > 0; --crc_bit) {
-            if (crc & 0x80)
-                crc = (crc << 1) ^ CRC8_POLYNOMIAL;
-            else
-                crc = (crc << 1);
-        }
-    }
-    return crc;
+    return sensirion_crc8(data, count);
 }
 
 int8_t sensirion_i2c_check_crc(const uint8_t* data, uint16_t count,
                                uint8_t checksum) {
-    if (sensirion_i2c_generate_crc(data, count) != checksum)
+    uint8_t crc = (count == SENSIRION_WORD_SIZE) ? sensirion_crc8_word(data)
+                                                 : sensirion_crc8(data, count);
+
+    if (crc != checksum)
         return CRC_ERROR;
     return NO_ERROR;
 }
@@ -77,8 +67,7 @@ uint16_t sensirion_i2c_fill_cmd_send_buf(uint8_t* buf, uint16_t cmd,
         buf[idx++] = (uint8_t)((args[i] & 0xFF00) >> 8);
         buf[idx++] = (uint8_t)((args[i] & 0x00FF) >> 0);
 
-        uint8_t crc = sensirion_i2c_generate_crc((uint8_t*)&buf[idx - 2],
-                                                 SENSIRION_WORD_SIZE);
+        uint8_t crc = sensirion_crc8_word(&buf[idx - 2]);
         buf[idx++] = crc;
     }
     return idx;
@@ -181,13 +170,11 @@ uint16_t sensirion_i2c_add_uint32_t_to_buffer(uint8_t* buffer, uint16_t offset,
                                               uint32_t data) {
     buffer[offset++] = (uint8_t)((data & 0xFF000000) >> 24);
     buffer[offset++] = (uint8_t)((data & 0x00FF0000) >> 16);
-    buffer[offset] = sensirion_i2c_generate_crc(
-        &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+    buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
     offset++;
     buffer[offset++] = (uint8_t)((data & 0x0000FF00) >> 8);
     buffer[offset++] = (uint8_t)((data & 0x000000FF) >> 0);
-    buffer[offset] = sensirion_i2c_generate_crc(
-        &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+    buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
     offset++;
 
     return offset;
@@ -202,8 +189,7 @@ uint16_t sensirion_i2c_add_uint16_t_to_buffer(uint8_t* buffer, uint16_t offset,
                                               uint16_t data) {
     buffer[offset++] = (uint8_t)((data & 0xFF00) >> 8);
     buffer[offset++] = (uint8_t)((data & 0x00FF) >> 0);
-    buffer[offset] = sensirion_i2c_generate_crc(
-        &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+    buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
     offset++;
 
     return offset;
@@ -225,13 +211,11 @@ uint16_t sensirion_i2c_add_float_to_buffer(uint8_t* buffer, uint16_t offset,
 
     buffer[offset++] = (uint8_t)((convert.uint32_data & 0xFF000000) >> 24);
     buffer[offset++] = (uint8_t)((convert.uint32_data & 0x00FF0000) >> 16);
-    buffer[offset] = sensirion_i2c_generate_crc(
-        &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+    buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
     offset++;
     buffer[offset++] = (uint8_t)((convert.uint32_data & 0x0000FF00) >> 8);
     buffer[offset++] = (uint8_t)((convert.uint32_data & 0x000000FF) >> 0);
-    buffer[offset] = sensirion_i2c_generate_crc(
-        &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+    buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
     offset++;
 
     return offset;
@@ -250,8 +234,7 @@ uint16_t sensirion_i2c_add_bytes_to_buffer(uint8_t* buffer, uint16_t offset,
         buffer[offset++] = data[i];
         buffer[offset++] = data[i + 1];
 
-        buffer[offset] = sensirion_i2c_generate_crc(
-            &buffer[offset - SENSIRION_WORD_SIZE], SENSIRION_WORD_SIZE);
+        buffer[offset] = sensirion_crc8_word(&buffer[offset - SENSIRION_WORD_SIZE]);
         offset++;
     }
 
@@ -292,3 +275,100 @@ int16_t sensirion_i2c_read_data_inplace(uint8_t address, uint8_t* buffer,
 
     return NO_ERROR;
 }
+
+/* A word and its CRC are 3 bytes, the words are never aligned: they are
+ * assembled from byte loads, which is also what a REV16 of a halfword load
+ * would give on a core without unaligned access. */
+static inline uint16_t sensirion_i2c_get_word(const uint8_t* word) {
+    return (uint16_t)((uint16_t)word[0] << 8 | word[1]);
+}
+
+static bool sensirion_i2c_check_frame(const uint8_t* buffer, uint16_t size) {
+    const uint8_t* end = buffer + size;
+
+    for (; buffer < end; buffer += SENSIRION_WORD_SIZE + CRC8_LEN) {
+        if (sensirion_crc8_word(buffer) != buffer[SENSIRION_WORD_SIZE])
+            return false;
+    }
+    return true;
+}
+
+static inline int32_t sensirion_i2c_scale(const sensirion_i2c_field* field,
+                                          int32_t raw) {
+    if (field->mul == 0)
+        return raw;
+    return raw * field->mul / ((int32_t)1 << field->shift) + field->add;
+}
+
+const sensirion_i2c_field sensirion_i2c_uint32_field = {
+    SENSIRION_FIELD_UINT32, 0, 0, 0, 0};
+
+int16_t sensirion_i2c_read_frame(uint8_t address, uint8_t* buffer,
+                                 const sensirion_i2c_field* fields,
+                                 uint8_t num_fields, void* dest) {
+    int16_t error;
+    uint8_t i;
+    uint16_t size = 0;
+    uint16_t value;
+    uint8_t* out;
+
+    for (i = 0; i < num_fields; i++) {
+        size += (fields[i].type == SENSIRION_FIELD_UINT32 ? 2 : 1) *
+                (SENSIRION_WORD_SIZE + CRC8_LEN);
+    }
+    error = sensirion_i2c_hal_read(address, buffer, size);
+    if (error) {
+        return error;
+    }
+    /* dest is left as it was unless the whole frame is good */
+    if (!sensirion_i2c_check_frame(buffer, size)) {
+        return CRC_ERROR;
+    }
+
+    for (i = 0; i < num_fields; i++) {
+        value = sensirion_i2c_get_word(buffer);
+        buffer += SENSIRION_WORD_SIZE + CRC8_LEN;
+        out = (uint8_t*)dest + fields[i].offset;
+        switch (fields[i].type) {
+            case SENSIRION_FIELD_UINT16:
+                *(uint16_t*)out = value;
+                break;
+            case SENSIRION_FIELD_INT16:
+                *(int16_t*)out =
+                    (int16_t)sensirion_i2c_scale(&fields[i], (int16_t)value);
+                break;
+            case SENSIRION_FIELD_TICKS:
+                *(int32_t*)out = sensirion_i2c_scale(&fields[i], value);
+                break;
+            case SENSIRION_FIELD_UINT32:
+                *(uint32_t*)out =
+                    (uint32_t)value << 16 | sensirion_i2c_get_word(buffer);
+                buffer += SENSIRION_WORD_SIZE + CRC8_LEN;
+                break;
+            default:
+                break;
+        }
+    }
+    return NO_ERROR;
+}
+
+int16_t sensirion_i2c_read_values(uint8_t address, uint8_t* buffer,
+                                  uint16_t* const* words, uint8_t num_words) {
+    int16_t error;
+    uint8_t i;
+    uint16_t size = num_words * (SENSIRION_WORD_SIZE + CRC8_LEN);
+
+    error = sensirion_i2c_hal_read(address, buffer, size);
+    if (error) {
+        return error;
+    }
+    if (!sensirion_i2c_check_frame(buffer, size)) {
+        return CRC_ERROR;
+    }
+
+    for (i = 0; i < num_words; i++) {
+        *words[i] = sensirion_i2c_get_word(buffer);
+        buffer += SENSIRION_WORD_SIZE + CRC8_LEN;
+    }
+    return NO_ERROR;
+}
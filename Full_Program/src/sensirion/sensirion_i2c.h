@@ -34,6 +34,8 @@
 
 #include "sensirion_config.h"
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -308,6 +310,80 @@ int16_t sensirion_i2c_write_data(uint8_t address, const uint8_t* data,
  */
 int16_t sensirion_i2c_read_data_inplace(uint8_t address, uint8_t* buffer,
                                         uint16_t expected_data_length);
+
+/*
+ * Frame codec: a response is walked twice, straight from the received
+ * buffer. The first pass checks the CRC of every word, the second decodes
+ * the words into their destination, instead of compacting them in place
+ * first and converting them one by one afterwards. The second pass only
+ * runs on a good frame, so nothing is written on a CRC error.
+ *
+ * The field descriptors are used where the words land in one structure:
+ * the measurement frames of sensirion_api.c and the 32-bit getters of
+ * sen5x_i2c.c. The other getters of sen5x_i2c.c and scd4x_i2c.c return each
+ * word through its own pointer and use sensirion_i2c_read_values, which
+ * checks and decodes the same way from a list of pointers.
+ */
+typedef enum {
+    SENSIRION_FIELD_UINT16,     /* 1 word into a uint16_t */
+    SENSIRION_FIELD_INT16,      /* 1 word into an int16_t, scaled */
+    SENSIRION_FIELD_TICKS,      /* 1 unsigned word into an int32_t, scaled */
+    SENSIRION_FIELD_UINT32,     /* 2 words into a uint32_t, MSB word first */
+    SENSIRION_FIELD_SKIP,       /* 1 word checked and dropped */
+} SENSIRION_FIELD_TYPE;
+
+/*
+ * One field of a frame. The scaled types store raw * mul / 2^shift + add,
+ * the division rounds toward zero, or the raw value when mul is 0.
+ */
+typedef struct {
+    uint8_t type;               /* SENSIRION_FIELD_TYPE */
+    uint8_t offset;             /* of the value in the destination */
+    uint8_t shift;
+    int16_t mul;
+    int32_t add;
+} sensirion_i2c_field;
+
+#define SENSIRION_FIELD(type, dest_type, member)                          \
+    { SENSIRION_FIELD_##type, (uint8_t)offsetof(dest_type, member), 0, 0, 0 }
+#define SENSIRION_FIELD_SCALED(type, dest_type, member, mul, shift, add)  \
+    { SENSIRION_FIELD_##type, (uint8_t)offsetof(dest_type, member),       \
+      (shift), (mul), (add) }
+
+/* A uint32_t alone in its destination, for the getters of a single value */
+extern const sensirion_i2c_field sensirion_i2c_uint32_field;
+
+/**
+ * sensirion_i2c_read_frame() - Reads a frame, checks the CRC of every word
+ * and then decodes its fields into a structure.
+ *
+ * @param address    Sensor I2C address
+ * @param buffer     Buffer for the frame as received, 3 bytes per word
+ * @param fields     Fields in the order of the frame
+ * @param num_fields Number of fields
+ * @param dest       Structure the offsets of the fields refer to
+ *
+ * @return           NO_ERROR on success, an error code otherwise. dest is
+ *                   only written on success.
+ */
+int16_t sensirion_i2c_read_frame(uint8_t address, uint8_t* buffer,
+                                 const sensirion_i2c_field* fields,
+                                 uint8_t num_fields, void* dest);
+
+/**
+ * sensirion_i2c_read_values() - Reads a frame of 16-bit values, checks the
+ * CRC of every word and then stores each word into its own variable.
+ *
+ * @param address   Sensor I2C address
+ * @param buffer    Buffer for the frame as received, 3 bytes per word
+ * @param words     Destination of each word, int16_t variables cast
+ * @param num_words Number of words
+ *
+ * @return          NO_ERROR on success, an error code otherwise. The
+ *                  variables are only written on success.
+ */
+int16_t sensirion_i2c_read_values(uint8_t address, uint8_t* buffer,
+                                  uint16_t* const* words, uint8_t num_words);
 #ifdef __cplusplus
 }
 #endif
@@ -41,63 +41,519 @@
 *******************************************************************************/
 
 
-#include <xc.h>
 #include <stddef.h>
 #include "tasks.h"
 
-#define MAX_TASKS 10
+#define TASK_NOT_QUEUED 0xFF
 
+// What a task runs and how it is scheduled. The descriptors of TASK_TABLE are
+// constant and stay in flash; the tasks created at run time take theirs from
+// task_dynamic.
 typedef struct {
-    uint16_t delay;
-    uint16_t reload;
-    uint8_t trigger;
-    void (*taskHandler)(void);
+    TASK_CALLBACK taskHandler;
+    uintptr_t context;
+    const char *name;           // NULL for tasks registered at run time
+    uint32_t delay;             // TASK_EVENT for the event tasks
+    uint32_t reload;            // initial period, see Task_modify
+    uint32_t wcet_us;           // declared worst-case run time, for Task_plan
+    uint8_t priority;
+} Task_descriptor;
+
+// Run time state of a task slot, in RAM
+typedef struct {
+    const Task_descriptor *desc;    // NULL for a free slot
+    uint32_t expiry;
+    uint32_t release;           // expiry of the activation a coroutine is in
+    uint32_t reload;
+    bool resumed;               // last run ended in TASK_SLEEP or TASK_AWAIT
+    uint16_t resume_point;      // where TASK_BEGIN resumes the coroutine
+    uintptr_t payload;          // payload of the event being handled
 } Task;
 
-Task tasks[MAX_TASKS];
+// The tasks of TASK_TABLE take the first slots, Task_start points them to
+// their descriptors and queues them the first time the scheduler runs. These
+// slots are not reused once the task is deleted.
+#define TASK_TABLE_INIT(id, name, handler, context, delay, reload, priority, \
+                        wcet_us)                                            \
+    [id] = { (handler), (context), (name), (delay), (reload), (wcet_us),    \
+             (priority) },
+
+_Static_assert(TASK_STATIC_COUNT <= MAX_TASKS, "TASK_TABLE exceeds MAX_TASKS");
+
+#define TASK_IS_EVENT(task_idx) (tasks[task_idx].desc->delay == TASK_EVENT)
+
+static const Task_descriptor task_table[TASK_STATIC_COUNT] = {
+    TASK_TABLE(TASK_TABLE_INIT)
+};
+static Task_descriptor task_dynamic[MAX_TASKS - TASK_STATIC_COUNT];
+static Task tasks[MAX_TASKS];
+static bool task_started = false;
+static uint32_t task_busy_window_us = 0;
+
+// Pending tasks are kept in one binary min-heap per priority, ordered by
+// their absolute expiry tick, so Task_execute only looks at the heads to find
+// the next due task.
+typedef struct {
+    uint8_t size;
+    uint8_t task[MAX_TASKS];
+} Task_heap;
+
+static Task_heap task_heaps[TASK_PRIORITY_LEVELS];
+static uint8_t task_heap_pos[MAX_TASKS];
+static uint8_t task_running = TASK_NOT_QUEUED;
+static bool task_yield = false;
+
+// Events posted with Task_post wait in one single-producer/single-consumer
+// ring per interrupt priority level, plus one for thread mode. Interrupts of
+// the same priority never preempt each other, so each ring only has one
+// writer at a time and needs no critical section: the producer owns head and
+// dropped, Task_execute owns tail, and each is published with a single store.
+#define TASK_EVENT_LEVELS TASK_PORT_EVENT_LEVELS
+
+typedef struct {
+    uintptr_t payload[TASK_EVENT_QUEUE_SIZE];
+    uint8_t task[TASK_EVENT_QUEUE_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t dropped;
+} Task_event_queue;
+
+static Task_event_queue task_events[TASK_EVENT_LEVELS];
+
+// A topic keeps the last version published and the event tasks it is posted
+// to, one bit per task slot. TASK_TOPICS gives the subscribers known at build
+// time.
+typedef struct {
+    uintptr_t version;
+    uint32_t subscribers;
+} Task_topic;
+
+#define TASK_TOPIC_INIT(id, subscribers)  [id] = { 0, (subscribers) },
+
+_Static_assert(MAX_TASKS <= 32, "topic subscriber masks hold 32 tasks");
+
+static Task_topic task_topics[TASK_TOPIC_COUNT] = { TASK_TOPICS(TASK_TOPIC_INIT) };
+
+static volatile uint32_t task_ticks = 0;
+static volatile bool task_wakeup = false;
+
+#if TASK_PROFILING
+#define TASK_COUNTS_PER_TICK TASK_PORT_COUNTS_PER_TICK
+#define TASK_COUNTS_PER_US   TASK_PORT_COUNTS_PER_US
+
+// Timing figures are kept in tick timer counts and converted on Task_get_stats
+typedef struct {
+    uint32_t runs;
+    uint32_t last;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t latency;
+    uint32_t latency_max;
+    uint32_t overruns;
+} Task_profile;
+
+static Task_profile task_profile[MAX_TASKS];
+static uint32_t task_idle_loops = 0;
+static uint64_t task_busy_counts = 0;
+static uint64_t task_sleep_counts = 0;
+static uint32_t task_window_start = 0;
+
+static uint32_t Task_timestamp(void)
+{
+    uint32_t ticks, counts;
+
+    // re-read if the tick moved meanwhile
+    do
+    {
+        ticks = task_ticks;
+        counts = TASK_PORT_COUNTS_IN_TICK();
+    } while(ticks != task_ticks);
+    return ticks * TASK_COUNTS_PER_TICK + counts;
+}
+#endif
+
+static bool Task_is_before(uint8_t a, uint8_t b)
+{
+    // wrap-around safe comparison of the 32-bit expiry ticks
+    return (int32_t)(tasks[a].expiry - tasks[b].expiry) < 0;
+}
+
+static void Task_heap_swap(Task_heap *h, uint8_t a, uint8_t b)
+{
+    uint8_t tmp = h->task[a];
+    h->task[a] = h->task[b];
+    h->task[b] = tmp;
+    task_heap_pos[h->task[a]] = a;
+    task_heap_pos[h->task[b]] = b;
+}
+
+static void Task_heap_sift_up(Task_heap *h, uint8_t pos)
+{
+    while(pos > 0)
+    {
+        uint8_t parent = (pos - 1) / 2;
+        if(!Task_is_before(h->task[pos], h->task[parent])) break;
+        Task_heap_swap(h, pos, parent);
+        pos = parent;
+    }
+}
+
+static void Task_heap_sift_down(Task_heap *h, uint8_t pos)
+{
+    while(true)
+    {
+        uint8_t child = 2 * pos + 1;
+        if(child >= h->size) break;
+        if((child + 1 < h->size) &&
+           Task_is_before(h->task[child + 1], h->task[child]))
+        {
+            child++;
+        }
+        if(!Task_is_before(h->task[child], h->task[pos])) break;
+        Task_heap_swap(h, pos, child);
+        pos = child;
+    }
+}
+
+static void Task_heap_push(uint8_t task_idx)
+{
+    Task_heap *h = &task_heaps[tasks[task_idx].desc->priority];
+    uint8_t pos = h->size++;
+    h->task[pos] = task_idx;
+    task_heap_pos[task_idx] = pos;
+    Task_heap_sift_up(h, pos);
+}
+
+static void Task_heap_remove(uint8_t task_idx)
+{
+    Task_heap *h = &task_heaps[tasks[task_idx].desc->priority];
+    uint8_t pos = task_heap_pos[task_idx];
+    uint8_t last = --h->size;
+    task_heap_pos[task_idx] = TASK_NOT_QUEUED;
+    if(pos != last)
+    {
+        uint8_t moved = h->task[last];
+        h->task[pos] = moved;
+        task_heap_pos[moved] = pos;
+        Task_heap_sift_up(h, pos);
+        Task_heap_sift_down(h, task_heap_pos[moved]);
+    }
+}
+
+static void Task_start(void)
+{
+    // queue the tasks of TASK_TABLE, their delay counts from the first run
+    task_started = true;
+    for(uint8_t i = 0; i < TASK_STATIC_COUNT; i++)
+    {
+        task_heap_pos[i] = TASK_NOT_QUEUED;
+#if TASK_PROFILING
+        task_profile[i] = (Task_profile){ .min = UINT32_MAX };
+#endif
+        tasks[i].desc = &task_table[i];
+        tasks[i].reload = task_table[i].reload;
+        if(!TASK_IS_EVENT(i))
+        {
+            tasks[i].expiry = task_ticks + task_table[i].delay;
+            Task_heap_push(i);
+        }
+    }
+    for(uint8_t i = TASK_STATIC_COUNT; i < MAX_TASKS; i++)
+    {
+        task_heap_pos[i] = TASK_NOT_QUEUED;
+    }
+}
+
+// Next task to run: the head of the highest priority heap with a due task
+static uint8_t Task_next_due(uint32_t now)
+{
+    for(int8_t p = TASK_PRIORITY_LEVELS - 1; p >= 0; p--)
+    {
+        Task_heap *h = &task_heaps[p];
+        if(h->size && (int32_t)(tasks[h->task[0]].expiry - now) <= 0)
+        {
+            return h->task[0];
+        }
+    }
+    return TASK_NOT_QUEUED;
+}
+
+static uint32_t Task_rearm(uint8_t task_idx, uint32_t now)
+{
+    uint32_t late, missed = 0;
+    uint32_t reload = tasks[task_idx].reload;
+
+    tasks[task_idx].expiry += reload;
+    late = now - tasks[task_idx].expiry;
+    if((int32_t)late > 0)
+    {
+        // activations were missed while the loop was blocked: skip the ones
+        // already past, but keep the original phase of the task. One due
+        // right now still runs.
+        missed = (late - 1) / reload + 1;
+        tasks[task_idx].expiry += missed * reload;
+    }
+    return missed;
+}
 
 void Task_synch(void)
 {
-    for(uint8_t i = 0; i<MAX_TASKS; i++)
+    task_ticks++;
+}
+
+bool Task_post(uint8_t task_idx, uintptr_t payload)
+{
+    Task_event_queue *q = &task_events[TASK_PORT_EVENT_LEVEL()];
+    uint8_t head = q->head;
+    const Task_descriptor *desc;
+
+    if(task_idx >= MAX_TASKS) return false;
+    desc = tasks[task_idx].desc;
+    if(desc == NULL || desc->delay != TASK_EVENT) return false;
+    if((uint8_t)(head - q->tail) >= TASK_EVENT_QUEUE_SIZE)
+    {
+        q->dropped++;
+        return false;
+    }
+    q->task[head % TASK_EVENT_QUEUE_SIZE] = task_idx;
+    q->payload[head % TASK_EVENT_QUEUE_SIZE] = payload;
+    TASK_PORT_BARRIER();
+    q->head = head + 1;
+    Task_wakeup();
+    return true;
+}
+
+uintptr_t Task_payload(void)
+{
+    return (task_running < MAX_TASKS) ? tasks[task_running].payload : 0;
+}
+
+uint32_t Task_events_dropped(void)
+{
+    uint32_t dropped = 0;
+
+    for(uint8_t level = 0; level < TASK_EVENT_LEVELS; level++)
+    {
+        dropped += task_events[level].dropped;
+    }
+    return dropped;
+}
+
+bool Task_subscribe(uint8_t topic, uint8_t task_idx)
+{
+    // only event tasks can take the version as payload
+    if(topic >= TASK_TOPIC_COUNT || task_idx >= MAX_TASKS ||
+       tasks[task_idx].desc == NULL || !TASK_IS_EVENT(task_idx)) return false;
+    task_topics[topic].subscribers |= TASK_BIT(task_idx);
+    return true;
+}
+
+void Task_unsubscribe(uint8_t topic, uint8_t task_idx)
+{
+    if(topic < TASK_TOPIC_COUNT && task_idx < MAX_TASKS)
+    {
+        task_topics[topic].subscribers &= ~TASK_BIT(task_idx);
+    }
+}
+
+uint8_t Task_publish(uint8_t topic, uintptr_t version)
+{
+    uint32_t pending;
+    uint8_t posted = 0;
+
+    if(topic >= TASK_TOPIC_COUNT) return 0;
+    task_topics[topic].version = version;
+    // events run in the order they are posted: the higher priority stages
+    // go first, so a lower priority one already sees their results
+    for(uint8_t priority = TASK_PRIORITY_LEVELS; priority-- > 0;)
     {
-        if(tasks[i].taskHandler)
+        pending = task_topics[topic].subscribers;
+        for(uint8_t i = 0; pending != 0; i++, pending >>= 1)
         {
-            if(tasks[i].delay > 0) tasks[i].delay--;
-            if(tasks[i].delay == 0)
-            {
-                tasks[i].delay = tasks[i].reload;
-                tasks[i].trigger = 1;
-            }            
+            if((pending & 1) && tasks[i].desc &&
+               tasks[i].desc->priority == priority &&
+               Task_post(i, version)) posted++;
         }
     }
+    return posted;
 }
 
-uint8_t Task_register(uint16_t delay, uint16_t reload, void (* task)(void))
+uintptr_t Task_topic_version(uint8_t topic)
+{
+    return (topic < TASK_TOPIC_COUNT) ? task_topics[topic].version : 0;
+}
+
+void Task_sleep(uint32_t ms)
 {
-    for(uint8_t i = 0; i<MAX_TASKS; i++)
+    if(task_running < MAX_TASKS)
+    {
+        // the current tick is already partly gone: wait for one more
+        tasks[task_running].expiry = task_ticks + ms + 1;
+        task_yield = true;
+    }
+}
+
+bool Task_is_resumed(void)
+{
+    return (task_running < MAX_TASKS) && tasks[task_running].resumed;
+}
+
+uint16_t *Task_resume_point(void)
+{
+    // a handler called outside of the scheduler always starts from the top
+    static uint16_t task_no_resume_point;
+
+    if(task_running < MAX_TASKS) return &tasks[task_running].resume_point;
+    task_no_resume_point = 0;
+    return &task_no_resume_point;
+}
+
+void Task_wakeup(void)
+{
+    task_wakeup = true;
+}
+
+void Task_idle(void)
+{
+#if TASK_TICKLESS_IDLE
+    uint32_t idle_ticks;
+
+    if(!task_started) Task_start();
+    TASK_PORT_IRQ_DISABLE();
+    // an interrupt ran after the main loop polled its flags: don't sleep
+    if(task_wakeup)
+    {
+        task_wakeup = false;
+        TASK_PORT_IRQ_ENABLE();
+        return;
+    }
+    idle_ticks = TASK_IDLE_LIMIT();
+    if(idle_ticks == 0)
     {
-        if(tasks[i].taskHandler == NULL)
+        TASK_PORT_IRQ_ENABLE();
+        return;
+    }
+    for(uint8_t p = 0; p < TASK_PRIORITY_LEVELS; p++)
+    {
+        uint32_t ticks;
+        if(task_heaps[p].size == 0) continue;
+        ticks = tasks[task_heaps[p].task[0]].expiry - task_ticks;
+        if((int32_t)ticks <= 0)
+        {
+            TASK_PORT_IRQ_ENABLE();
+            return;
+        }
+        if(ticks < idle_ticks) idle_ticks = ticks;
+    }
+
+#if TASK_PROFILING
+    uint32_t start = Task_timestamp();
+#endif
+    TASK_IDLE_WAKEUP_ENABLE();
+    task_ticks += TASK_PORT_SLEEP(idle_ticks);
+    TASK_IDLE_WAKEUP_DISABLE();
+    TASK_PORT_IRQ_ENABLE();
+#if TASK_PROFILING
+    task_sleep_counts += Task_timestamp() - start;
+#endif
+#endif
+}
+
+static uint8_t Task_alloc(uint32_t expiry, uint32_t reload, uint8_t priority,
+                          bool event, TASK_CALLBACK task, uintptr_t context)
+{
+    if(!task_started) Task_start();
+    if(priority >= TASK_PRIORITY_LEVELS) priority = TASK_PRIORITY_LEVELS - 1;
+
+    for(uint8_t i = TASK_STATIC_COUNT; i<MAX_TASKS; i++)
+    {
+        if(tasks[i].desc == NULL)
         {
-            tasks[i].delay = delay;
+            Task_descriptor *desc = &task_dynamic[i - TASK_STATIC_COUNT];
+            desc->taskHandler = task;
+            desc->context = context;
+            desc->name = NULL;
+            desc->delay = event ? TASK_EVENT : expiry - task_ticks;
+            desc->reload = reload;
+            desc->wcet_us = 0;
+            desc->priority = priority;
+            tasks[i].expiry = expiry;
             tasks[i].reload = reload;
-            tasks[i].trigger = 0;
-            tasks[i].taskHandler = task;
+            tasks[i].resumed = false;
+            tasks[i].payload = 0;
+            task_heap_pos[i] = TASK_NOT_QUEUED;
+#if TASK_PROFILING
+            task_profile[i] = (Task_profile){ .min = UINT32_MAX };
+#endif
+            // publish the descriptor last, Task_post checks the slot from ISRs
+            TASK_PORT_BARRIER();
+            tasks[i].desc = desc;
             return i;
         }
     }
     return TASK_FULL;
 }
 
+uint8_t Task_create(uint32_t delay, uint32_t reload, uint8_t priority,
+                    TASK_CALLBACK task, uintptr_t context)
+{
+    uint8_t i = Task_alloc(task_ticks + delay, reload, priority, false, task,
+                           context);
+
+    if(i != TASK_FULL) Task_heap_push(i);
+    return i;
+}
+
+uint8_t Task_create_event(uint8_t priority, TASK_CALLBACK task,
+                          uintptr_t context)
+{
+    return Task_alloc(task_ticks, 0, priority, true, task, context);
+}
+
+// Tasks registered with the old signature get their function as context
+static void Task_call_legacy(uintptr_t context)
+{
+    ((void (*)(void))context)();
+}
+
+uint8_t Task_register(uint16_t delay, uint16_t reload, void (* task)(void))
+{
+    return Task_create(delay, reload, TASK_PRIORITY_NORMAL, Task_call_legacy,
+                       (uintptr_t)task);
+}
+
+uint8_t Task_register_event(void (* task)(void))
+{
+    return Task_create_event(TASK_PRIORITY_NORMAL, Task_call_legacy,
+                             (uintptr_t)task);
+}
+
 void Task_delete(uint8_t task_idx)
 {
-    if(task_idx < MAX_TASKS)
+    if(!task_started) Task_start();
+    if(task_idx < MAX_TASKS && tasks[task_idx].desc)
     {
-        tasks[task_idx].taskHandler = NULL;
-        tasks[task_idx].trigger = 0;        
+        if(task_running == task_idx)
+        {
+            // a task deleting itself is not queued, just don't re-arm it
+            task_running = TASK_NOT_QUEUED;
+        }
+        else if(task_heap_pos[task_idx] != TASK_NOT_QUEUED)
+        {
+            // event tasks are only queued while a coroutine waits
+            Task_heap_remove(task_idx);
+        }
+        // a new task taking the slot must not inherit the subscriptions
+        for(uint8_t topic = 0; topic < TASK_TOPIC_COUNT; topic++)
+        {
+            Task_unsubscribe(topic, task_idx);
+        }
+        tasks[task_idx].desc = NULL;
     }        
 }
 
-void Task_modify(uint8_t task_idx, uint16_t reload)
+void Task_modify(uint8_t task_idx, uint32_t reload)
 {
     if(task_idx < MAX_TASKS)
     {
@@ -105,23 +561,326 @@ void Task_modify(uint8_t task_idx, uint16_t reload)
     }        
 }
 
+static void Task_dispatch(uint8_t i, uint32_t now)
+{
+#if TASK_PROFILING
+    uint32_t start, elapsed;
+#endif
+
+    if(!tasks[i].resumed)
+    {
+        tasks[i].release = tasks[i].expiry;
+        tasks[i].resume_point = 0;
+    }
+    task_running = i;
+    task_yield = false;
+#if TASK_PROFILING
+    start = Task_timestamp();
+    task_profile[i].latency = start - tasks[i].expiry * TASK_COUNTS_PER_TICK;
+    if(task_profile[i].latency > task_profile[i].latency_max)
+        task_profile[i].latency_max = task_profile[i].latency;
+#endif
+    tasks[i].desc->taskHandler(tasks[i].desc->context);
+#if TASK_PROFILING
+    elapsed = Task_timestamp() - start;
+    task_busy_counts += elapsed;
+    task_profile[i].runs++;
+    task_profile[i].last = elapsed;
+    task_profile[i].total += elapsed;
+    if(elapsed < task_profile[i].min) task_profile[i].min = elapsed;
+    if(elapsed > task_profile[i].max) task_profile[i].max = elapsed;
+#endif
+    // the task may have deleted itself while running
+    if(task_running != i) return;
+    task_running = TASK_NOT_QUEUED;
+
+    // a coroutine gave the CPU back: queue it again at its wake-up tick
+    tasks[i].resumed = task_yield;
+    if(task_yield)
+    {
+        Task_heap_push(i);
+        return;
+    }
+    tasks[i].expiry = tasks[i].release;
+
+    // event tasks stay registered until the next Task_post
+    if(TASK_IS_EVENT(i)) return;
+
+    // if it is a single-run task, release the slot
+    if(tasks[i].reload == 0)
+    {
+        tasks[i].desc = NULL;
+    }
+    else
+    {
+#if TASK_PROFILING
+        task_profile[i].overruns += Task_rearm(i, now);
+#else
+        Task_rearm(i, now);
+#endif
+        Task_heap_push(i);
+    }
+}
+
+static bool Task_dispatch_events(uint32_t now)
+{
+    Task_event_queue *q;
+    uint8_t head, tail, i;
+    bool dispatched = false;
+
+    // higher interrupt priorities first, thread mode posts last. Events posted
+    // while the queue is drained wait for the next pass.
+    for(q = &task_events[0]; q < &task_events[TASK_EVENT_LEVELS]; q++)
+    {
+        head = q->head;
+        TASK_PORT_BARRIER();
+        while((tail = q->tail) != head)
+        {
+            i = q->task[tail % TASK_EVENT_QUEUE_SIZE];
+            // a coroutine still busy with its previous event blocks the queue
+            // so the events keep their order
+            if(tasks[i].desc && tasks[i].resumed) break;
+
+            tasks[i].payload = q->payload[tail % TASK_EVENT_QUEUE_SIZE];
+            q->tail = tail + 1;
+            // the task may have been deleted after the event was posted
+            if(tasks[i].desc == NULL || !TASK_IS_EVENT(i)) continue;
+
+            tasks[i].expiry = now;
+            Task_dispatch(i, now);
+            dispatched = true;
+        }
+    }
+    return dispatched;
+}
+
 void Task_execute(void)
 {
-    for(uint8_t i = 0; i<MAX_TASKS; i++)
+    uint32_t now = task_ticks;
+    uint8_t i;
+    bool idle;
+
+    if(!task_started) Task_start();
+    idle = !Task_dispatch_events(now);
+
+    // look again from the highest priority after each task
+    while((i = Task_next_due(now)) != TASK_NOT_QUEUED)
+    {
+        Task_heap_remove(i);
+        Task_dispatch(i, now);
+        idle = false;
+    }    
+#if TASK_PROFILING
+    if(idle) task_idle_loops++;
+#else
+    (void)idle;
+#endif
+}
+
+static uint32_t Task_gcd(uint32_t a, uint32_t b)
+{
+    while(b)
+    {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+// Run time used to plan a task, in us: declared, else measured, else 1 tick
+static uint32_t Task_wcet(uint8_t i)
+{
+    if(tasks[i].desc->wcet_us) return tasks[i].desc->wcet_us;
+#if TASK_PROFILING
+    if(task_profile[i].runs) return task_profile[i].max / TASK_COUNTS_PER_US;
+#endif
+    return TASK_COUNTS_PER_TICK / TASK_COUNTS_PER_US;
+}
+
+// Worst busy window of the planned releases: the longest time the loop stays
+// busy without a break, when every task runs for its full wcet. phase is the
+// first release of each task, in ticks from the plan on.
+static uint32_t Task_busy_window(const uint8_t *order, uint8_t n,
+                                 const uint32_t *phase)
+{
+    uint32_t release[MAX_TASKS];
+    uint32_t hyperperiod = 1;
+    uint32_t busy_start = 0, busy_end = 0, worst = 0;
+    uint32_t t;
+    uint8_t k, next;
+
+    // no periodic task, nothing is released
+    if(n == 0) return 0;
+
+    for(k = 0; k < n; k++)
+    {
+        uint32_t period = tasks[order[k]].reload;
+        uint32_t g = Task_gcd(hyperperiod, period);
+        // beyond the limit the releases are only checked up to it
+        if(hyperperiod / g > TASK_PLAN_MAX_HYPERPERIOD / period)
+        {
+            hyperperiod = TASK_PLAN_MAX_HYPERPERIOD;
+            break;
+        }
+        hyperperiod = hyperperiod / g * period;
+    }
+    // the pattern repeats with the hyperperiod, a start delay only moves it
+    for(k = 0; k < n; k++) release[k] = phase[order[k]] % tasks[order[k]].reload;
+
+    while(true)
+    {
+        next = 0;
+        for(k = 1; k < n; k++)
+        {
+            if(release[k] < release[next]) next = k;
+        }
+        if(release[next] >= hyperperiod) break;
+
+        t = release[next] * 1000U;
+        if(t >= busy_end) busy_start = busy_end = t;
+        busy_end += Task_wcet(order[next]);
+        if(busy_end - busy_start > worst) worst = busy_end - busy_start;
+        release[next] += tasks[order[next]].reload;
+    }
+    return worst;
+}
+
+uint32_t Task_plan(void)
+{
+    uint8_t order[MAX_TASKS];
+    uint32_t phase[MAX_TASKS];
+    uint32_t wcet_ms[MAX_TASKS];
+    uint32_t g[MAX_TASKS], d[MAX_TASKS], step_mod[MAX_TASKS];
+    uint32_t origin, base, range, step, o, best;
+    uint8_t n = 0, i, j, k, m;
+
+    if(!task_started) Task_start();
+    origin = task_ticks + 1U;
+
+    // queued periodic tasks, higher priority first, then shorter period
+    for(i = 0; i < MAX_TASKS; i++)
+    {
+        if(tasks[i].desc == NULL || TASK_IS_EVENT(i) ||
+           tasks[i].reload == 0 || tasks[i].resumed ||
+           task_heap_pos[i] == TASK_NOT_QUEUED) continue;
+        wcet_ms[i] = (Task_wcet(i) + 999U) / 1000U;
+        for(k = n; k > 0; k--)
+        {
+            j = order[k - 1];
+            if(tasks[j].desc->priority > tasks[i].desc->priority ||
+               (tasks[j].desc->priority == tasks[i].desc->priority &&
+                tasks[j].reload <= tasks[i].reload)) break;
+            order[k] = j;
+        }
+        order[k] = i;
+        n++;
+    }
+
+    // Place the tasks one by one. The releases of two tasks of periods Pi and
+    // Pj only meet modulo gcd(Pi, Pj), so each task is delayed further by the
+    // offset that keeps the most slack between the end of one task and the
+    // next release of another. The start delay of the task is kept.
+    for(k = 0; k < n; k++)
     {
-        if(tasks[i].taskHandler && tasks[i].trigger)
+        int32_t best_slack = INT32_MIN;
+        i = order[k];
+        base = (int32_t)(tasks[i].expiry - origin) > 0 ? tasks[i].expiry - origin : 0;
+        range = 1;
+        best = 0;
+
+        // offsets only matter modulo the lcm of the gcds, which divides Pi
+        for(m = 0; m < k; m++)
+        {
+            j = order[m];
+            g[m] = Task_gcd(tasks[i].reload, tasks[j].reload);
+            range = range / Task_gcd(range, g[m]) * g[m];
+            // distance from a release of j to the next release of i
+            d[m] = (base % g[m] + g[m] - phase[j] % g[m]) % g[m];
+        }
+        // long periods are searched in steps, which bounds the work
+        step = (range + TASK_PLAN_MAX_OFFSETS - 1U) / TASK_PLAN_MAX_OFFSETS;
+        for(m = 0; m < k; m++) step_mod[m] = step % g[m];
+
+        for(o = 0; k && o < range; o += step)
         {
-            tasks[i].trigger = 0;
-            // if we have a valid function pointer, call the function
-            if(tasks[i].taskHandler)
+            int32_t slack = INT32_MAX;
+            for(m = 0; m < k; m++)
             {
-                tasks[i].taskHandler();
-            }            
-            // if it is a single-run task, erase the function pointer
-            if(tasks[i].reload == 0)
+                j = order[m];
+                int32_t after = (int32_t)d[m] - (int32_t)wcet_ms[j];
+                int32_t before = (int32_t)(g[m] - d[m]) - (int32_t)wcet_ms[i];
+                if(after < slack) slack = after;
+                if(before < slack) slack = before;
+                // the distance at the next offset, without a division
+                d[m] += step_mod[m];
+                if(d[m] >= g[m]) d[m] -= g[m];
+            }
+            if(slack > best_slack)
             {
-                tasks[i].taskHandler = NULL;
+                best_slack = slack;
+                best = o;
             }
         }
-    }    
-}
\ No newline at end of file
+        phase[i] = base + best;
+    }
+
+    // re-phase the tasks, counted from the next tick on
+    for(k = 0; k < n; k++)
+    {
+        i = order[k];
+        Task_heap_remove(i);
+        tasks[i].expiry = origin + phase[i];
+        Task_heap_push(i);
+    }
+
+    task_busy_window_us = Task_busy_window(order, n, phase);
+    return task_busy_window_us;
+}
+
+uint32_t Task_get_busy_window(void)
+{
+    return task_busy_window_us;
+}
+
+#if TASK_PROFILING
+bool Task_get_stats(uint8_t task_idx, Task_stats *stats)
+{
+    Task_profile *p;
+
+    if(task_idx >= MAX_TASKS || tasks[task_idx].desc == NULL)
+        return false;
+
+    p = &task_profile[task_idx];
+    stats->name = tasks[task_idx].desc->name;
+    stats->runs = p->runs;
+    stats->overruns = p->overruns;
+    stats->last_us = p->last / TASK_COUNTS_PER_US;
+    stats->min_us = p->runs ? p->min / TASK_COUNTS_PER_US : 0;
+    stats->max_us = p->max / TASK_COUNTS_PER_US;
+    stats->avg_us = p->runs ? (uint32_t)(p->total / p->runs) / TASK_COUNTS_PER_US : 0;
+    stats->latency_us = p->latency / TASK_COUNTS_PER_US;
+    stats->latency_max_us = p->latency_max / TASK_COUNTS_PER_US;
+    return true;
+}
+
+void Task_get_load(Task_load *load, bool restart)
+{
+    uint32_t now = task_ticks;
+    uint64_t window;
+
+    load->window_ms = now - task_window_start;
+    load->idle_loops = task_idle_loops;
+    window = (uint64_t)load->window_ms * TASK_COUNTS_PER_TICK;
+    load->task_load = window ? (uint8_t)(task_busy_counts * 100U / window) : 0;
+    load->sleep = window ? (uint8_t)(task_sleep_counts * 100U / window) : 0;
+
+    if(restart)
+    {
+        task_window_start = now;
+        task_idle_loops = 0;
+        task_busy_counts = 0;
+        task_sleep_counts = 0;
+    }
+}
+#endif
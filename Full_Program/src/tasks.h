@@ -15,12 +15,44 @@
  *    real time means that there is no guarantee of real time operation. I.e.,
  *    in case some "task" blocks the task loop, other tasks will not get executed.
  *    It is a task of the programmer to ensure that no task will block.
+ *    Task_synch only advances a tick counter, so its cost inside the 1 ms
+ *    interrupt does not depend on the number of tasks. Task_execute keeps the
+ *    registered tasks ordered by their next expiry tick and only dispatches
+ *    the tasks that are due.
  * 
  *  How to use this module:
  *    1. Call Task_synch each 1 ms
  *    2. Register the task at program beginning or when needed.
  *    3. Call Task_execute inside the main loop
- *    To register a task:
+ *    4. Optionally call Task_idle at the end of the main loop. With
+ *       TASK_TICKLESS_IDLE enabled the core sleeps in WFI until the next task
+ *       or software timer is due or another interrupt arrives. Interrupt
+ *       handlers that leave work for the main loop must call Task_wakeup.
+ *    5. Tasks registered with Task_register_event run only when an event is
+ *       posted to them with Task_post, once per event, on the next
+ *       Task_execute. TASK_TABLE entries with TASK_EVENT as delay are event
+ *       tasks too. Task_payload returns the payload of the event being
+ *       handled. Task_post can be called from thread mode and from any
+ *       interrupt handler except NMI and HardFault; events that do not fit in
+ *       the queue are counted by Task_events_dropped.
+ *    6. With TASK_PROFILING enabled, Task_get_stats returns the execution
+ *       time, release-to-start latency and overruns of a task, measured with
+ *       the SysTick counter at microsecond resolution. Task_get_load returns
+ *       the share of time spent in tasks and asleep, and the number of loop
+ *       passes that found no task due.
+ *    7. A producer task that completes a piece of data calls Task_publish
+ *       with a topic and a version number of the data. The version is posted
+ *       as event payload to each event task subscribed to the topic, so the
+ *       consumers run once per new version instead of polling on their own
+ *       timers. Subscribers are listed in TASK_TOPICS of tasks_config.h or
+ *       added with Task_subscribe. A consumer that runs late can compare
+ *       Task_payload with Task_topic_version and skip the stale versions.
+ *    Tasks known at build time are better declared in TASK_TABLE of
+ *    tasks_config.h: they get a TASK_ID from the table, their descriptors are
+ *    constant data in flash and they need no call to be registered. Only the
+ *    run time state of each task slot is kept in RAM. At most
+ *    MAX_TASKS - TASK_STATIC_COUNT tasks can be created at run time.
+ *    To register a task at run time:
  *      a. define a delay to start the task. delay = 0 start task immediately.
  *      b. define a reload time to repeat the task. reload = 0 execute the task
  *         only once and the resources for the task are released.
@@ -32,6 +64,39 @@
  *      - Task_register(100, 200, doSomething);
  *      Example: execute doSomething only once after 200 ms:
  *      - Task_register(200, 0, doSomething);
+ *    Task_register is kept for handlers without parameter. Task_create takes
+ *    32-bit delay and reload times (up to 24 days), a priority and a context
+ *    value that is passed to the handler, so the same handler can serve
+ *    several devices:
+ *      - Task_create(0, 3600000, TASK_PRIORITY_LOW, doHourly, (uintptr_t)dev);
+ *    When several tasks are due, the higher priority ones run first.
+ *    Task_plan, called once after the tasks are registered, delays the next
+ *    release of each periodic task further so that tasks with common
+ *    multiples of their periods do not fire on the same tick. The start
+ *    delays are kept: the added offset is less than the period of the task,
+ *    and at most TASK_PLAN_MAX_OFFSETS offsets are tried for each task, in
+ *    even steps for the long periods. It uses the wcet_us column
+ *    of TASK_TABLE, or the measured maximum run time, and returns the worst
+ *    busy window of the resulting schedule over the hyperperiod.
+ *    A task can also be written as a stackless coroutine that gives the CPU
+ *    back while it waits, instead of calling a blocking delay:
+ *      void doSomething(void)
+ *      {
+ *          TASK_BEGIN();
+ *          start_conversion();
+ *          TASK_SLEEP(20);
+ *          TASK_AWAIT(conversion_done());
+ *          read_conversion();
+ *          TASK_END();
+ *      }
+ *    TASK_SLEEP(ms) resumes after at least ms milliseconds and TASK_AWAIT
+ *    checks its condition again at each tick until it is true.
+ *    Local variables are lost at each TASK_SLEEP or TASK_AWAIT: keep them
+ *    static, or in the context when the handler serves several tasks. The
+ *    resume point itself is kept per task. These macros must not be used
+ *    inside a switch statement. The
+ *    reload period still counts from the release of the first part, so a
+ *    coroutine keeps its phase however long it waits.
  * 
  *******************************************************************************/
 
@@ -63,17 +128,134 @@
 
 #define TASK_FULL 0xFF
 
-#include "definitions.h" // include processor files - each processor file is guarded.  
+#include "tasks_port.h"
+
+#ifndef MAX_TASKS
+#define MAX_TASKS 10
+#endif
+
+// Events each interrupt priority level can queue, must be a power of two
+#ifndef TASK_EVENT_QUEUE_SIZE
+#define TASK_EVENT_QUEUE_SIZE 8
+#endif
+
+// Set to 0 to keep the main loop spinning instead of sleeping between tasks
+#ifndef TASK_TICKLESS_IDLE
+#define TASK_TICKLESS_IDLE 1
+#endif
+
+// Task_plan checks the releases of at most this many ticks (1 hour)
+#ifndef TASK_PLAN_MAX_HYPERPERIOD
+#define TASK_PLAN_MAX_HYPERPERIOD 3600000U
+#endif
+
+// Task_plan tries at most this many offsets for each task
+#ifndef TASK_PLAN_MAX_OFFSETS
+#define TASK_PLAN_MAX_OFFSETS 1000U
+#endif
+
+// Set to 0 to remove the per-task timing statistics
+#ifndef TASK_PROFILING
+#define TASK_PROFILING 1
+#endif
 
 #ifdef	__cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+#define TASK_PRIORITY_LOW       0
+#define TASK_PRIORITY_NORMAL    1
+#define TASK_PRIORITY_HIGH      2
+#define TASK_PRIORITY_LEVELS    3
+
+// Delay of the TASK_TABLE entries that only run on Task_post
+#define TASK_EVENT              0xFFFFFFFFU
+
+typedef void (*TASK_CALLBACK)(uintptr_t context);
+
+#ifndef TASK_TABLE
+#include "tasks_config.h"
+#endif
+
+#define TASK_TABLE_ID(id, ...)  id,
+
+typedef enum {
+    TASK_TABLE(TASK_TABLE_ID)
+    TASK_STATIC_COUNT
+} TASK_ID;
+
+// Topics of tasks_config.h, an application without topics leaves it empty
+#ifndef TASK_TOPICS
+#define TASK_TOPICS(X)
+#endif
+
+#define TASK_TOPIC_ID(id, ...)  id,
+#define TASK_BIT(task_idx)      (1UL << (task_idx))
+
+typedef enum {
+    TASK_TOPICS(TASK_TOPIC_ID)
+    TASK_TOPIC_COUNT
+} TASK_TOPIC;
+
+// Stackless coroutine support, see the notes above
+// The resume point is kept in the slot of the task, so a handler created for
+// several contexts resumes each of its tasks where that one stopped.
+#define TASK_BEGIN()        uint16_t *task_resume_point = Task_resume_point(); \
+                            switch(*task_resume_point) { case 0:
+#define TASK_SLEEP(ms)      do { Task_sleep(ms); *task_resume_point = __LINE__; \
+                                 return; case __LINE__:; } while(0)
+#define TASK_AWAIT(cond)    do { *task_resume_point = __LINE__; case __LINE__: \
+                                 if(!(cond)) { Task_sleep(0); return; }       \
+                            } while(0)
+#define TASK_END()          } *task_resume_point = 0
+
+typedef struct {
+    const char *name;           // NULL for tasks registered at run time
+    uint32_t runs;
+    uint32_t last_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t avg_us;
+    uint32_t latency_us;        // release tick to start of the last run
+    uint32_t latency_max_us;
+    uint32_t overruns;          // activations skipped because the task ran late
+} Task_stats;
+
+typedef struct {
+    uint32_t window_ms;         // time since the last restart of the window
+    uint32_t idle_loops;        // Task_execute calls with no task due
+    uint8_t task_load;          // % of the window spent inside tasks
+    uint8_t sleep;              // % of the window spent asleep in Task_idle
+} Task_load;
+
 void Task_execute(void);
 void Task_delete(uint8_t task_idx);
-void Task_modify(uint8_t task_idx, uint16_t reload);
+void Task_modify(uint8_t task_idx, uint32_t reload);
 void Task_synch(void);
+void Task_idle(void);
+void Task_wakeup(void);
+void Task_sleep(uint32_t ms);
+bool Task_is_resumed(void);
+uint16_t *Task_resume_point(void);
+uint8_t Task_create(uint32_t delay, uint32_t reload, uint8_t priority,
+                    TASK_CALLBACK task, uintptr_t context);
+uint8_t Task_create_event(uint8_t priority, TASK_CALLBACK task,
+                          uintptr_t context);
 uint8_t Task_register(uint16_t delay, uint16_t reload, void (* task)(void));
+uint8_t Task_register_event(void (* task)(void));
+bool Task_post(uint8_t task_idx, uintptr_t payload);
+uintptr_t Task_payload(void);
+uint32_t Task_events_dropped(void);
+bool Task_subscribe(uint8_t topic, uint8_t task_idx);
+void Task_unsubscribe(uint8_t topic, uint8_t task_idx);
+uint8_t Task_publish(uint8_t topic, uintptr_t version);
+uintptr_t Task_topic_version(uint8_t topic);
+uint32_t Task_plan(void);
+uint32_t Task_get_busy_window(void);
+#if TASK_PROFILING
+bool Task_get_stats(uint8_t task_idx, Task_stats *stats);
+void Task_get_load(Task_load *load, bool restart);
+#endif
 
 #ifdef	__cplusplus
 }
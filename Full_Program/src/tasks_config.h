@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *  Static task table of the application
+ *
+ *  File Name:
+ *    tasks_config.h
+ *
+ *  Summary:
+ *    Tasks started by the scheduler without a call to Task_register.
+ *
+ *  Description:
+ *    Each X() entry declares one task:
+ *      X(id, name, handler, context, delay, reload, priority, wcet_us)
+ *    id is the TASK_ID used with Task_post, Task_delete, Task_modify, etc.
+ *    delay counts from the first call to Task_execute. An entry with
+ *    TASK_EVENT as delay only runs when an event is posted to it. wcet_us is
+ *    the longest run time of the task as shown by the 't' command, Task_plan
+ *    uses it to spread the releases.
+ *    Data handed from one task to the next goes through the topics of
+ *    TASK_TOPICS: the sensor task publishes each new set of readings and the
+ *    display, CSV and alarm stages run once per set.
+ *******************************************************************************/
+
+#ifndef TASKS_CONFIG_H
+#define	TASKS_CONFIG_H
+
+#include "app.h"
+
+#define TASK_TABLE(X)                                                                            \
+    X(TASK_SENSOR, "sensor", sensor_task,     0, 0,          2000, TASK_PRIORITY_NORMAL,  3000)  \
+    X(TASK_OLED,   "oled",   print_oled_data, 0, TASK_EVENT,    0, TASK_PRIORITY_LOW,    10000)  \
+    X(TASK_LED,    "led",    toggle_led,      0, 0,           500, TASK_PRIORITY_HIGH,      20)  \
+    X(TASK_BUTTON, "button", button_task,     0, TASK_EVENT,    0, TASK_PRIORITY_HIGH,       0)  \
+    X(TASK_CSV,    "csv",    csv_task,        0, TASK_EVENT,    0, TASK_PRIORITY_LOW,    20000)  \
+    X(TASK_ALARM,  "alarm",  alarm_task,      0, TASK_EVENT,    0, TASK_PRIORITY_NORMAL,   500)
+
+// Each X() entry declares one topic and the tasks subscribed to it:
+//   X(id, subscribers)
+#define TASK_TOPICS(X)                                                                           \
+    X(TOPIC_SENSOR_DATA, TASK_BIT(TASK_ALARM) | TASK_BIT(TASK_OLED) | TASK_BIT(TASK_CSV))
+
+#endif	/* TASKS_CONFIG_H */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *  Hardware port of the task scheduler
+ *
+ *  File Name:
+ *    tasks_port.h
+ *
+ *  Summary:
+ *    Everything tasks.c needs from the core and the tick timer.
+ *
+ *  Description:
+ *    By default the scheduler runs on the Cortex-M0+ with SysTick as tick
+ *    source. Defining TASK_PORT_HOST builds tasks.c on a PC against a virtual
+ *    clock instead, to compare scheduler variants under a simulated load:
+ *    the simulator calls Task_synch for each virtual tick, stands in for the
+ *    interrupt priority of the caller of Task_post and provides the
+ *    Task_port_host_* functions below. TASK_TABLE can be defined on the
+ *    command line to replace the task table of tasks_config.h.
+ *******************************************************************************/
+
+#ifndef TASKS_PORT_H
+#define	TASKS_PORT_H
+
+#ifdef TASK_PORT_HOST
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// the virtual clock counts microseconds
+#define TASK_PORT_COUNTS_PER_TICK   1000U
+#define TASK_PORT_COUNTS_PER_US     1U
+#define TASK_PORT_EVENT_LEVELS      2U
+
+#define TASK_PORT_IRQ_DISABLE()
+#define TASK_PORT_IRQ_ENABLE()
+#define TASK_PORT_BARRIER()         __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#define TASK_PORT_COUNTS_IN_TICK()  Task_port_host_counts()
+#define TASK_PORT_EVENT_LEVEL()     Task_port_host_event_level()
+#define TASK_PORT_SLEEP(ticks)      Task_port_host_sleep(ticks)
+
+#ifndef TASK_IDLE_WAKEUP_ENABLE
+#define TASK_IDLE_WAKEUP_ENABLE()
+#define TASK_IDLE_WAKEUP_DISABLE()
+#endif
+
+#ifndef TASK_IDLE_LIMIT
+#define TASK_IDLE_LIMIT()           UINT32_MAX
+#endif
+
+// Counts elapsed in the current virtual tick, below TASK_PORT_COUNTS_PER_TICK
+uint32_t Task_port_host_counts(void);
+// Event queue of the caller of Task_post: 0 "interrupt", 1 thread
+uint8_t Task_port_host_event_level(void);
+// Advances the virtual clock by up to idle_ticks, returns the ticks skipped
+// without a call to Task_synch
+uint32_t Task_port_host_sleep(uint32_t idle_ticks);
+
+#else
+
+#include <xc.h>
+#include "definitions.h" // include processor files - each processor file is guarded.  
+
+#define TASK_PORT_COUNTS_PER_TICK   (SYSTICK_FREQ / 1000U)
+#define TASK_PORT_COUNTS_PER_US     (SYSTICK_FREQ / 1000000U)
+// one event queue per interrupt priority level, plus one for thread mode
+#define TASK_PORT_EVENT_LEVELS      ((1U << __NVIC_PRIO_BITS) + 1U)
+
+#define TASK_PORT_IRQ_DISABLE()     __disable_irq()
+#define TASK_PORT_IRQ_ENABLE()      __enable_irq()
+#define TASK_PORT_BARRIER()         __DMB()
+// SysTick counts down from TASK_PORT_COUNTS_PER_TICK - 1 inside the tick
+#define TASK_PORT_COUNTS_IN_TICK()  (TASK_PORT_COUNTS_PER_TICK - 1U - SysTick->VAL)
+#define TASK_PORT_EVENT_LEVEL()     Task_port_event_level()
+#define TASK_PORT_SLEEP(ticks)      SYSTICK_TicklessIdle(ticks)
+
+// Wake-up sources armed only while the core sleeps in Task_idle
+#ifndef TASK_IDLE_WAKEUP_ENABLE
+#define TASK_IDLE_WAKEUP_ENABLE()   SERCOM5_USART_ReceiverWakeupEnable()
+#define TASK_IDLE_WAKEUP_DISABLE()  SERCOM5_USART_ReceiverWakeupDisable()
+#endif
+
+// Ticks until the next deadline of other tick users, Task_idle does not
+// sleep past it
+#ifndef TASK_IDLE_LIMIT
+#include "timer_wheel.h"
+#define TASK_IDLE_LIMIT()           Timer_idle_ticks()
+#endif
+
+static inline uint8_t Task_port_event_level(void)
+{
+    uint32_t exception = __get_IPSR();
+
+    if(exception == 0) return TASK_PORT_EVENT_LEVELS - 1U;
+    // NMI and HardFault have fixed priorities above all others
+    if(exception < 4) return 0;
+    return NVIC_GetPriority((IRQn_Type)((int32_t)exception - 16));
+}
+
+#endif
+
+#endif	/* TASKS_PORT_H */
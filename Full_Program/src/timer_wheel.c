@@ -0,0 +1,271 @@
+/*******************************************************************************
+  Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    timer_wheel.c
+
+  Summary:
+    Software timers based on a hierarchical timing wheel.
+
+  Description:
+    Level 0 of the wheel holds the timers due within the next TIMER_SLOTS
+    ticks, one slot per tick. Each upper level holds TIMER_SLOTS times longer
+    delays per slot. Each time level 0 wraps around, the next slot of level 1
+    is moved down into level 0, and so on up the levels ("cascade"). A timer
+    is therefore moved at most TIMER_LEVELS - 1 times in its life.
+ *******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+#include <xc.h>
+#include <stddef.h>
+#include "timer_wheel.h"
+
+#define TIMER_SLOT_MASK     (TIMER_SLOTS - 1U)
+#define TIMER_RANGE         (1UL << (TIMER_SLOT_BITS * TIMER_LEVELS))
+#define TIMER_EXPIRED       TIMER_LEVELS      // level of the timers being called
+#define TIMER_NO_WORK       UINT32_MAX
+
+#define TIMER_MS_TO_TICKS(ms) ((ms) / (SYSTICK_INTERRUPT_PERIOD_IN_US / 1000U))
+
+static TIMER *timer_wheel[TIMER_LEVELS][TIMER_SLOTS];
+static uint32_t timer_level_count[TIMER_LEVELS];
+// non-empty level 0 slots, a bit may stay set after its last timer stopped
+static uint32_t timer_slot_pending = 0;
+static TIMER *timer_expired = NULL;
+static uint32_t timer_running = 0;
+// next tick to be processed by Timer_execute
+static uint32_t timer_wheel_time = 0;
+
+static void Timer_link(TIMER **head, TIMER *timer)
+{
+    timer->next = *head;
+    if(*head) (*head)->pprev = &timer->next;
+    *head = timer;
+    timer->pprev = head;
+}
+
+static void Timer_unlink(TIMER *timer)
+{
+    *timer->pprev = timer->next;
+    if(timer->next) timer->next->pprev = timer->pprev;
+    timer->pprev = NULL;
+    if(timer->level < TIMER_LEVELS) timer_level_count[timer->level]--;
+    timer_running--;
+}
+
+static void Timer_insert(TIMER *timer)
+{
+    uint32_t expiry = timer->expiry;
+    uint32_t delta = expiry - timer_wheel_time;
+    uint8_t level = 0;
+    uint8_t slot;
+
+    if((int32_t)delta < 0)
+    {
+        // already due: take the next tick
+        expiry = timer_wheel_time;
+        delta = 0;
+    }
+    else if(delta >= TIMER_RANGE)
+    {
+        // out of range: park in the last slot reachable, it comes back here
+        // with its real expiry when that slot cascades
+        expiry = timer_wheel_time + TIMER_RANGE - 1U;
+        delta = TIMER_RANGE - 1U;
+    }
+    while(delta >= (1UL << (TIMER_SLOT_BITS * (level + 1U)))) level++;
+
+    slot = (expiry >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK;
+    Timer_link(&timer_wheel[level][slot], timer);
+    timer->level = level;
+    timer_level_count[level]++;
+    timer_running++;
+    if(level == 0) timer_slot_pending |= 1UL << slot;
+}
+
+static void Timer_cascade(uint8_t level, uint8_t slot)
+{
+    TIMER *timer = timer_wheel[level][slot];
+    TIMER *next;
+
+    timer_wheel[level][slot] = NULL;
+    while(timer)
+    {
+        next = timer->next;
+        timer_level_count[level]--;
+        timer_running--;
+        Timer_insert(timer);
+        timer = next;
+    }
+}
+
+// Ticks from timer_wheel_time to the next tick with some work: a level 0
+// slot with timers or a cascade from the upper levels
+static uint32_t Timer_next_work(void)
+{
+    uint8_t idx = timer_wheel_time & TIMER_SLOT_MASK;
+    uint8_t slot;
+    bool upper = false;
+
+    for(uint8_t level = 1; level < TIMER_LEVELS; level++)
+    {
+        if(timer_level_count[level]) upper = true;
+    }
+    if(upper && idx == 0) return 0;
+
+    // level 0 slots of this round, from the current one up
+    for(slot = idx; slot < TIMER_SLOTS; slot++)
+    {
+        if(!(timer_slot_pending & (1UL << slot))) continue;
+        if(timer_wheel[0][slot]) return slot - idx;
+        timer_slot_pending &= ~(1UL << slot);
+    }
+    if(upper) return TIMER_SLOTS - idx;
+
+    // only timers of the next round of level 0 remain
+    for(slot = 0; slot < idx; slot++)
+    {
+        if(!(timer_slot_pending & (1UL << slot))) continue;
+        if(timer_wheel[0][slot]) return TIMER_SLOTS - idx + slot;
+        timer_slot_pending &= ~(1UL << slot);
+    }
+    return TIMER_NO_WORK;
+}
+
+// Processes the tick timer_wheel_time: cascades the upper levels when level 0
+// wraps and moves the due timers to the expired list
+static void Timer_process_tick(void)
+{
+    uint32_t time = timer_wheel_time;
+    uint8_t idx = time & TIMER_SLOT_MASK;
+    TIMER *timer;
+
+    for(uint8_t level = 1; level < TIMER_LEVELS; level++)
+    {
+        if((time >> (TIMER_SLOT_BITS * (level - 1U))) & TIMER_SLOT_MASK) break;
+        Timer_cascade(level,
+                      (time >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK);
+    }
+
+    // the expired list is always empty here
+    timer_expired = timer_wheel[0][idx];
+    timer_wheel[0][idx] = NULL;
+    timer_slot_pending &= ~(1UL << idx);
+    if(timer_expired) timer_expired->pprev = &timer_expired;
+    for(timer = timer_expired; timer; timer = timer->next)
+    {
+        timer->level = TIMER_EXPIRED;
+        timer_level_count[0]--;
+    }
+    timer_wheel_time = time + 1U;
+}
+
+void Timer_init(TIMER *timer, TIMER_CALLBACK callback, uintptr_t context)
+{
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->callback = callback;
+    timer->context = context;
+}
+
+void Timer_start(TIMER *timer, uint32_t delay_ms)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t now;
+
+    __disable_irq();
+    now = SYSTICK_GetTickCounter();
+    if(timer->pprev) Timer_unlink(timer);
+    // an empty wheel can jump to the present instead of catching up
+    if(timer_running == 0) timer_wheel_time = now + 1U;
+    timer->expiry = now + TIMER_MS_TO_TICKS(delay_ms);
+    Timer_insert(timer);
+    __set_PRIMASK(primask);
+}
+
+void Timer_stop(TIMER *timer)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if(timer->pprev) Timer_unlink(timer);
+    __set_PRIMASK(primask);
+}
+
+bool Timer_is_running(const TIMER *timer)
+{
+    return timer->pprev != NULL;
+}
+
+void Timer_execute(void)
+{
+    uint32_t now = SYSTICK_GetTickCounter();
+    uint32_t skip;
+    TIMER *timer;
+
+    while((int32_t)(now - timer_wheel_time) >= 0)
+    {
+        __disable_irq();
+        // jump over the ticks without work
+        skip = Timer_next_work();
+        if(skip > now - timer_wheel_time)
+        {
+            timer_wheel_time = now + 1U;
+            __enable_irq();
+            break;
+        }
+        timer_wheel_time += skip;
+        Timer_process_tick();
+        __enable_irq();
+
+        // take the timers one by one, a callback or an interrupt may stop or
+        // restart any of them meanwhile
+        while(true)
+        {
+            __disable_irq();
+            timer = timer_expired;
+            if(timer) Timer_unlink(timer);
+            __enable_irq();
+            if(timer == NULL) break;
+            timer->callback(timer->context);
+        }
+    }
+}
+
+uint32_t Timer_idle_ticks(void)
+{
+    uint32_t work;
+
+    // called with the interrupts disabled by Task_idle
+    if(timer_running == 0) return UINT32_MAX;
+    // Timer_execute did not catch up with the tick counter yet
+    if(timer_wheel_time != SYSTICK_GetTickCounter() + 1U) return 0;
+    work = Timer_next_work();
+    return (work == TIMER_NO_WORK) ? UINT32_MAX : work + 1U;
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *  Software timer module based on a hierarchical timing wheel
+ *
+ *  Company:
+ *    Microchip Technology Inc.
+ *
+ *  File Name:
+ *    timer_wheel.h
+ *
+ *  Summary:
+ *    One-shot software timers with callbacks run from the main loop.
+ *
+ *  Description:
+ *    The timers count the SysTick ticks of SYSTICK_GetTickCounter, the same
+ *    time base as SYSTICK_StartTimeOut. Instead of polling a SYSTICK_TIMEOUT,
+ *    the user starts a TIMER with a callback, which is called from
+ *    Timer_execute in thread context once the delay is over.
+ *    The timers are kept in a hierarchical timing wheel of TIMER_LEVELS levels
+ *    of TIMER_SLOTS slots each: Timer_start, Timer_stop and a restart are O(1)
+ *    and the work per tick does not depend on the number of running timers,
+ *    so hundreds of short timeouts can run at the same time.
+ *
+ *  How to use this module:
+ *    1. Call Timer_execute inside the main loop.
+ *    2. Set the callback once with Timer_init, the TIMER memory belongs to
+ *       the user and must stay valid while the timer runs.
+ *    3. Timer_start arms the timer, or restarts it if it is already running.
+ *       Timer_stop cancels it. Both can be called from interrupts and from
+ *       the callbacks.
+ *      Example: call timeout(ctx) once, 50 ms from now:
+ *      - static TIMER t;
+ *      - Timer_init(&t, timeout, ctx);
+ *      - Timer_start(&t, 50);
+ *    Task_idle asks Timer_idle_ticks how long the core may sleep, so the
+ *    timers keep working with the tickless idle of the task scheduler.
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef TIMER_WHEEL_H
+#define	TIMER_WHEEL_H
+
+#include "definitions.h" // include processor files - each processor file is guarded.  
+
+// 4 levels of 32 slots cover 2^20 ticks (17 minutes). Longer delays work
+// too, the timer is only moved down the wheel once more.
+#define TIMER_SLOT_BITS     5
+#define TIMER_SLOTS         (1U << TIMER_SLOT_BITS)
+#define TIMER_LEVELS        4
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void (*TIMER_CALLBACK)(uintptr_t context);
+
+typedef struct TIMER {
+    struct TIMER *next;
+    struct TIMER **pprev;       // NULL while the timer is not running
+    uint32_t expiry;
+    uint8_t level;
+    TIMER_CALLBACK callback;
+    uintptr_t context;
+} TIMER;
+
+void Timer_init(TIMER *timer, TIMER_CALLBACK callback, uintptr_t context);
+void Timer_start(TIMER *timer, uint32_t delay_ms);
+void Timer_stop(TIMER *timer);
+bool Timer_is_running(const TIMER *timer);
+void Timer_execute(void);
+uint32_t Timer_idle_ticks(void);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* TIMER_WHEEL_H */
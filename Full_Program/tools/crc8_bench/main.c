@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Checks the CRC-8 implementations of src/sensirion/sensirion_crc8.c
+ *  against the bitwise reference and times them on the host.
+ *
+ *  Build and run from this folder:
+ *
+ *  gcc -std=gnu99 -O2 -DSENSIRION_CRC8_ALL -I../../src/sensirion -o crc8_bench main.c \
+ *      ../../src/sensirion/sensirion_crc8.c
+ *  ./crc8_bench [words]
+ *
+ *  or with make crc8-check from the tools folder.
+ *
+ *  words       words per timed run, 1000000 by default
+ *
+ *  Every 2-byte word and buffers of 0 to 64 bytes are compared first, the
+ *  exit code is 1 when an implementation differs. The times are host CPU
+ *  cycles on x86 and nanoseconds elsewhere, per 2-byte word, the length of
+ *  all the CRCs of the I2C protocol. They show the ratio between the forms,
+ *  not the SAMD21 time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_UNIT "ns"
+#endif
+
+#include "sensirion_crc8.h"
+
+typedef uint8_t (*crc_buffer_fn)(const uint8_t* data, uint16_t count);
+typedef uint8_t (*crc_word_fn)(const uint8_t* word);
+
+typedef struct {
+    const char* name;
+    crc_buffer_fn buffer;
+    crc_word_fn word;
+} crc_impl;
+
+static const crc_impl impls[] = {
+    {"bitwise", sensirion_crc8_bitwise, sensirion_crc8_word_bitwise},
+    {"nibble", sensirion_crc8_nibble, sensirion_crc8_word_nibble},
+    {"table", sensirion_crc8_table, sensirion_crc8_word_table},
+};
+#define IMPL_COUNT (sizeof(impls) / sizeof(impls[0]))
+
+// the result is summed so the calls are not optimized away
+static volatile uint32_t sink;
+
+static uint64_t bench_now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static int cross_check(void) {
+    uint8_t data[64];
+    uint32_t value;
+    uint16_t len;
+    size_t i;
+    int errors = 0;
+
+    // example of the SCD4x and SEN5x datasheets: 0xBEEF -> 0x92
+    data[0] = 0xBE;
+    data[1] = 0xEF;
+    if (sensirion_crc8_bitwise(data, 2) != 0x92) {
+        printf("bitwise: CRC of 0xBEEF is 0x%02X, not 0x92\n",
+               sensirion_crc8_bitwise(data, 2));
+        errors++;
+    }
+    for (i = 0; i < IMPL_COUNT; i++) {
+        for (value = 0; value <= 0xFFFF; value++) {
+            data[0] = (uint8_t)(value >> 8);
+            data[1] = (uint8_t)value;
+            uint8_t expected = sensirion_crc8_bitwise(data, 2);
+            if (impls[i].word(data) != expected ||
+                impls[i].buffer(data, 2) != expected) {
+                printf("%s: CRC of word 0x%04X differs\n", impls[i].name,
+                       (unsigned)value);
+                errors++;
+                break;
+            }
+        }
+        srand(1);
+        for (len = 0; len <= sizeof(data); len++) {
+            for (value = 0; value < len; value++) {
+                data[value] = (uint8_t)rand();
+            }
+            if (impls[i].buffer(data, len) != sensirion_crc8_bitwise(data, len)) {
+                printf("%s: CRC of %u bytes differs\n", impls[i].name, len);
+                errors++;
+                break;
+            }
+        }
+    }
+    return errors;
+}
+
+static double bench_buffer(crc_buffer_fn fn, const uint8_t* words, uint32_t count) {
+    uint64_t start = bench_now();
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        sum += fn(&words[(i & 0xFFFU) * 2], 2);
+    }
+    sink += sum;
+    return (double)(bench_now() - start) / count;
+}
+
+static double bench_word(crc_word_fn fn, const uint8_t* words, uint32_t count) {
+    uint64_t start = bench_now();
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        sum += fn(&words[(i & 0xFFFU) * 2]);
+    }
+    sink += sum;
+    return (double)(bench_now() - start) / count;
+}
+
+int main(int argc, char** argv) {
+    static uint8_t words[0x1000 * 2];
+    uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 1000000U;
+    size_t i;
+    int errors;
+
+    errors = cross_check();
+    printf("cross-check against the bitwise reference: %s\n",
+           errors ? "FAILED" : "ok");
+
+    srand(2);
+    for (i = 0; i < sizeof(words); i++) {
+        words[i] = (uint8_t)rand();
+    }
+    if (count == 0) {
+        count = 1;
+    }
+    printf("\n%-8s %18s %18s\n", "", BENCH_UNIT "/word, buffer", BENCH_UNIT "/word, word");
+    for (i = 0; i < IMPL_COUNT; i++) {
+        // once to warm up the caches
+        bench_word(impls[i].word, words, count / 10 + 1);
+        double buffer = bench_buffer(impls[i].buffer, words, count);
+        double word = bench_word(impls[i].word, words, count);
+        printf("%-8s %18.2f %18.2f\n", impls[i].name, buffer, word);
+    }
+    printf("\nselected: SENSIRION_CRC8_IMPL %d\n", SENSIRION_CRC8_IMPL);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+Generates the lookup tables of the Sensirion CRC-8 (polynomial 0x31, MSB
+first) used by src/sensirion/sensirion_crc8.c.
+
+    python3 crc8_tables.py ../src/sensirion/sensirion_crc8_tables.h
+
+The 256-entry table gives the CRC of a byte, the 16-entry table the CRC of
+a nibble shifted into the high half, both with an initial value of 0.
+"""
+
+import argparse
+
+POLYNOMIAL = 0x31
+
+LICENSE = """/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+"""
+
+
+def crc_bits(value, bits):
+    """Shifts the top bits of value through the CRC register, MSB first."""
+    crc = value
+    for _ in range(bits):
+        crc = ((crc << 1) ^ POLYNOMIAL) if crc & 0x80 else (crc << 1)
+        crc &= 0xFF
+    return crc
+
+
+def c_table(name, values):
+    lines = []
+    for i in range(0, len(values), 12):
+        lines.append('    ' + ', '.join('0x%02X' % v for v in values[i:i + 12]) + ',')
+    return 'static const uint8_t %s[%d] = {\n%s\n};\n' % (name, len(values), '\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split('\n')[0])
+    parser.add_argument('output', help='C header to write')
+    args = parser.parse_args()
+
+    byte_table = [crc_bits(i, 8) for i in range(256)]
+    nibble_table = [crc_bits(i << 4, 4) for i in range(16)]
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write(LICENSE)
+        f.write('\n// Generated by tools/crc8_tables.py, polynomial 0x%02X\n\n' % POLYNOMIAL)
+        f.write('#ifndef SENSIRION_CRC8_TABLES_H\n#define SENSIRION_CRC8_TABLES_H\n\n')
+        f.write('#include <stdint.h>\n\n')
+        f.write('#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_TABLE || defined(SENSIRION_CRC8_ALL)\n')
+        f.write('// CRC of each byte value\n')
+        f.write(c_table('sensirion_crc8_byte_table', byte_table))
+        f.write('#endif\n\n')
+        f.write('#if SENSIRION_CRC8_IMPL == SENSIRION_CRC8_NIBBLE || defined(SENSIRION_CRC8_ALL)\n')
+        f.write('// CRC of each nibble value in the high half of the register\n')
+        f.write(c_table('sensirion_crc8_nibble_table', nibble_table))
+        f.write('#endif\n\n')
+        f.write('#endif /* SENSIRION_CRC8_TABLES_H */\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+Converts a PNG into a C header with the compressed image format drawn by
+oledc_draw_rle_image, see src/OLED/oled_image.h for the format.
+
+    python3 png2rle.py logo.png ../src/OLED/logo.h --name curiosity_logo_color
+
+Only the standard library is used. 8-bit grayscale, RGB, palette and alpha
+PNGs without interlace are read; alpha is blended over --bg.
+"""
+
+import argparse
+import collections
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 128
+MAX_PALETTE = 255
+COLOR_RAW = 0xFF
+
+LICENSE = """/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ */
+"""
+
+
+def read_png(path):
+    """Returns width, height and the pixels as (r, g, b, a) tuples."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG' % path)
+    pos, idat, plte, trns = 8, b'', None, None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            plte = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or interlace or channels is None:
+        sys.exit('%s: only 8-bit PNGs without interlace are supported' % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        line = raw[y * (stride + 1):(y + 1) * (stride + 1)]
+        ftype, row = line[0], bytearray(line[1:])
+        for i in range(stride):
+            a = row[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif ftype == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif ftype == 3:
+                row[i] = (row[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[i] = (row[i] + pred) & 0xFF
+        rows.append(row)
+        prev = row
+
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            v = row[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                pixels.append((v[0], v[0], v[0], 255))
+            elif ctype == 4:
+                pixels.append((v[0], v[0], v[0], v[1]))
+            elif ctype == 2:
+                pixels.append((v[0], v[1], v[2], 255))
+            elif ctype == 6:
+                pixels.append(tuple(v))
+            else:
+                alpha = trns[v[0]] if trns and v[0] < len(trns) else 255
+                pixels.append(plte[v[0]] + (alpha,))
+    return width, height, pixels
+
+
+def rgb565(pixel, bg):
+    r, g, b, a = pixel
+    r, g, b = [(c * a + k * (255 - a)) // 255 for c, k in zip((r, g, b), bg)]
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode(width, height, colors):
+    """Palette and run length blocks, as described in oled_image.h."""
+    palette = [c for c, _ in collections.Counter(colors).most_common(MAX_PALETTE)]
+    index = {c: i for i, c in enumerate(palette)}
+
+    def color(c):
+        if c in index:
+            return [index[c]]
+        return [COLOR_RAW, c >> 8, c & 0xFF]
+
+    out = [width, height, len(palette)]
+    for c in palette:
+        out += [c >> 8, c & 0xFF]
+
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(0x80 + len(literal) - 1)
+            for c in literal:
+                out.extend(color(c))
+            del literal[:]
+
+    i = 0
+    while i < len(colors):
+        n = 1
+        while i + n < len(colors) and n < MAX_RUN and colors[i + n] == colors[i]:
+            n += 1
+        if n > 1:
+            flush()
+            out.append(n - 1)
+            out.extend(color(colors[i]))
+        else:
+            literal.append(colors[i])
+            if len(literal) == MAX_RUN:
+                flush()
+        i += n
+    flush()
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('png')
+    parser.add_argument('header')
+    parser.add_argument('--name', help='array name, the PNG name by default')
+    parser.add_argument('--bg', default='000000', help='RGB hex color under transparent pixels')
+    args = parser.parse_args()
+
+    width, height, pixels = read_png(args.png)
+    if not 0 < width < 256 or not 0 < height < 256:
+        sys.exit('%s: the image must be smaller than 256 x 256' % args.png)
+    bg = [int(args.bg[i:i + 2], 16) for i in (0, 2, 4)]
+    data = encode(width, height, [rgb565(p, bg) for p in pixels])
+
+    name = args.name or os.path.splitext(os.path.basename(args.png))[0]
+    guard = os.path.basename(args.header).upper().replace('.', '_')
+    lines = [LICENSE,
+             '/* Generated by tools/png2rle.py from %s, do not edit */' % os.path.basename(args.png),
+             '',
+             '#ifndef %s' % guard,
+             '#define\t%s' % guard,
+             '',
+             '#include <stdint.h>',
+             '',
+             '/*',
+             ' *  OLED display image, compressed for oledc_draw_rle_image',
+             ' *  %d x %d, %d bytes instead of %d' % (width, height, len(data), width * height * 2),
+             ' */',
+             'const uint8_t %s[] = {' % name]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    lines += ['};', '', '#endif\t/* %s */' % guard, '']
+    with open(args.header, 'w') as f:
+        f.write('\n'.join(lines))
+    print('%s: %d x %d, %d bytes' % (args.header, width, height, len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,420 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Runs src/tasks.c on the host against a virtual clock, under a synthetic
+ *  load of periodic tasks and interrupt events, and reports how well the
+ *  scheduler keeps the releases.
+ *
+ *  Build and run from this folder, or with make in tools:
+ *
+ *  gcc -std=gnu99 -O2 -DTASK_PORT_HOST -D'TASK_TABLE(X)=' -DMAX_TASKS=16 \
+ *      -I../../src -o sched_bench main.c ../../src/tasks.c
+ *  ./sched_bench [-t ticks] [-n tasks] [-p]
+ *
+ *  -t ticks    virtual milliseconds to run, 60000 by default
+ *  -n tasks    periodic tasks of the load, 1 to 8, all by default
+ *  -p          call Task_plan after the first second and measure from there
+ *
+ *  The virtual clock counts microseconds. It only moves while a task runs,
+ *  by the synthetic run time of the task, in each pass of the main loop and
+ *  while Task_idle sleeps; the tick interrupt calls Task_synch at each
+ *  millisecond crossed and posts an event every BENCH_EVENT_TICKS. Run times
+ *  come from a fixed seed, so all the figures in virtual time are the same
+ *  on every run and every host: jitter is the time from the release tick of
+ *  an activation to the start of the task, missed activations are the ones
+ *  the scheduler skipped because the task was still late. The lines starting
+ *  with "host:" are host CPU cycles on x86, nanoseconds elsewhere, spent in
+ *  the scheduler itself: they show the trend between two builds, not the
+ *  SAMD21 time. "make -C tools sched-check" compares the virtual part with
+ *  sched_bench/expected.txt.
+ *
+ *  The scheduler variants are chosen with the options of tasks.h on the
+ *  command line, such as -DTASK_TICKLESS_IDLE=0.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_UNIT "ns"
+#endif
+
+#include "tasks.h"
+
+#if !TASK_PROFILING
+#error "the benchmark reads the latencies of Task_get_stats"
+#endif
+
+// virtual cost of one pass of the main loop, in us
+#define BENCH_LOOP_US       2U
+// the interrupt posts an event to the event task every this many ticks
+#define BENCH_EVENT_TICKS   25U
+// warm-up before Task_plan with -p
+#define BENCH_PLAN_TICKS    1000U
+
+typedef struct {
+    const char *name;
+    uint32_t period_ms;         // 0 for the event task
+    uint32_t min_us;            // synthetic run time, drawn in [min_us, max_us]
+    uint32_t max_us;
+    uint8_t priority;
+} bench_task;
+
+// a mixed load of about 50 %, the event task is always the last one
+static const bench_task bench_load[] = {
+    {"ctrl",      1,    40,    60, TASK_PRIORITY_HIGH},
+    {"adc",       5,   200,   400, TASK_PRIORITY_HIGH},
+    {"filter",   10,   500,  1500, TASK_PRIORITY_NORMAL},
+    {"led",      20,    20,    40, TASK_PRIORITY_HIGH},
+    {"comm",     20,  1000,  3000, TASK_PRIORITY_NORMAL},
+    {"log",      50,  2000,  6000, TASK_PRIORITY_NORMAL},
+    {"oled",    100,  5000, 12000, TASK_PRIORITY_LOW},
+    {"sensor", 2000,  3000,  3000, TASK_PRIORITY_NORMAL},
+    {"button",    0,   300,   800, TASK_PRIORITY_HIGH},
+};
+#define BENCH_LOAD_COUNT    (sizeof(bench_load) / sizeof(bench_load[0]))
+#define BENCH_PERIODIC_MAX  (BENCH_LOAD_COUNT - 1)
+
+typedef struct {
+    const bench_task *load;
+    uint8_t task_idx;
+    uint32_t runs;
+    uint32_t overruns;          // Task_get_stats count at the start of the run
+    uint32_t *jitter;           // us, one per run
+    uint32_t jitter_size;
+} bench_state;
+
+static bench_state bench[BENCH_LOAD_COUNT];
+static uint8_t bench_count;
+static bench_state *bench_event;
+
+static uint64_t sim_us;         // virtual clock
+static uint32_t sim_ticks;      // tick interrupts taken or skipped asleep
+static uint32_t sim_tick_irqs;  // tick interrupts taken
+static uint32_t sim_seed = 12345U;
+static uint8_t sim_level = 1U;  // event queue of the code running
+static bool sim_measuring = true;
+
+static uint64_t host_synch;     // spent in the tick interrupt
+static uint64_t host_tasks;     // spent inside the task handlers
+static uint64_t host_execute;   // spent in Task_execute, handlers excluded
+static uint32_t host_calls;     // of Task_execute
+static uint32_t host_dispatches;
+
+static uint64_t bench_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static uint32_t sim_random(uint32_t min, uint32_t max)
+{
+    sim_seed = sim_seed * 1103515245U + 12345U;
+    return min + (sim_seed >> 8) % (max - min + 1U);
+}
+
+static void sim_tick(void)
+{
+    uint64_t start = bench_now();
+
+    sim_ticks++;
+    sim_tick_irqs++;
+    Task_synch();
+    if(bench_event && sim_ticks % BENCH_EVENT_TICKS == 0)
+    {
+        sim_level = 0;
+        Task_post(bench_event->task_idx, sim_ticks);
+        sim_level = 1;
+    }
+    host_synch += bench_now() - start;
+}
+
+// Moves the virtual clock, with a tick interrupt at each millisecond crossed
+static void sim_advance(uint32_t us)
+{
+    while(us)
+    {
+        uint32_t to_tick = 1000U - (uint32_t)(sim_us % 1000U);
+        if(us < to_tick)
+        {
+            sim_us += us;
+            return;
+        }
+        sim_us += to_tick;
+        us -= to_tick;
+        sim_tick();
+    }
+}
+
+uint32_t Task_port_host_counts(void)
+{
+    return (uint32_t)(sim_us % 1000U);
+}
+
+uint8_t Task_port_host_event_level(void)
+{
+    return sim_level;
+}
+
+uint32_t Task_port_host_sleep(uint32_t idle_ticks)
+{
+    uint32_t ticks = idle_ticks;
+    uint32_t to_event;
+
+    // the event interrupt wakes the core as well
+    if(bench_event)
+    {
+        to_event = BENCH_EVENT_TICKS - sim_ticks % BENCH_EVENT_TICKS;
+        if(to_event < ticks) ticks = to_event;
+    }
+    // the ticks before the last one are skipped, the last one wakes the core
+    sim_ticks += ticks - 1U;
+    sim_us = (sim_us / 1000U + ticks - 1U) * 1000U;
+    sim_advance(1000U);
+    return ticks - 1U;
+}
+
+static void bench_handler(uintptr_t context)
+{
+    bench_state *b = (bench_state *)context;
+    Task_stats stats;
+    uint64_t start = bench_now();
+
+    // the scheduler measured the latency of this run before calling us
+    Task_get_stats(b->task_idx, &stats);
+    if(sim_measuring)
+    {
+        if(b->runs == b->jitter_size)
+        {
+            b->jitter_size = b->jitter_size ? b->jitter_size * 2U : 1024U;
+            b->jitter = realloc(b->jitter, b->jitter_size * sizeof(uint32_t));
+            if(b->jitter == NULL) exit(2);
+        }
+        b->jitter[b->runs++] = stats.latency_us;
+    }
+    sim_advance(sim_random(b->load->min_us, b->load->max_us));
+    host_tasks += bench_now() - start;
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_run(uint32_t ticks)
+{
+    uint32_t end = sim_ticks + ticks;
+    uint64_t start;
+
+    while((int32_t)(sim_ticks - end) < 0)
+    {
+        start = bench_now();
+        host_tasks = 0;
+        Task_execute();
+        host_execute += bench_now() - start - host_tasks;
+        host_calls++;
+        sim_advance(BENCH_LOOP_US);
+        Task_idle();
+    }
+}
+
+static void bench_restart(void)
+{
+    Task_stats stats;
+
+    for(uint8_t i = 0; i < bench_count; i++)
+    {
+        Task_get_stats(bench[i].task_idx, &stats);
+        bench[i].runs = 0;
+        bench[i].overruns = stats.overruns;
+    }
+}
+
+// Percentile of the sorted samples
+static uint32_t bench_percentile(const uint32_t *sorted, uint32_t count,
+                                 uint32_t percent)
+{
+    if(count == 0) return 0;
+    return sorted[(uint32_t)(((uint64_t)count - 1U) * percent / 100U)];
+}
+
+static void bench_report(uint32_t ticks)
+{
+    static const uint32_t bounds[] = {0, 100, 500, 1000, 2000, 5000, 10000};
+    uint32_t histogram[sizeof(bounds) / sizeof(bounds[0]) + 1];
+    uint32_t total_runs = 0, total_missed = 0;
+    Task_stats stats;
+    Task_load load;
+
+    memset(histogram, 0, sizeof(histogram));
+    printf("\nid task    period wcet(us)   runs missed   jitter(us): min   p50   p99   max   avg\n");
+    for(uint8_t i = 0; i < bench_count; i++)
+    {
+        bench_state *b = &bench[i];
+        uint64_t sum = 0;
+        uint32_t missed;
+
+        Task_get_stats(b->task_idx, &stats);
+        missed = stats.overruns - b->overruns;
+        qsort(b->jitter, b->runs, sizeof(uint32_t), bench_compare);
+        for(uint32_t r = 0; r < b->runs; r++)
+        {
+            uint8_t k = 0;
+            sum += b->jitter[r];
+            while(k < sizeof(bounds) / sizeof(bounds[0]) && b->jitter[r] > bounds[k]) k++;
+            histogram[k]++;
+        }
+        if(b->load->period_ms)
+            printf("%2u %-7s %6lu", i, b->load->name, (unsigned long)b->load->period_ms);
+        else
+            printf("%2u %-7s %6s", i, b->load->name, "event");
+        printf(" %4lu-%-5lu %6lu %6lu %17lu %5lu %5lu %5lu %5lu\n",
+               (unsigned long)b->load->min_us, (unsigned long)b->load->max_us,
+               (unsigned long)b->runs, (unsigned long)missed,
+               (unsigned long)(b->runs ? b->jitter[0] : 0),
+               (unsigned long)bench_percentile(b->jitter, b->runs, 50),
+               (unsigned long)bench_percentile(b->jitter, b->runs, 99),
+               (unsigned long)(b->runs ? b->jitter[b->runs - 1] : 0),
+               (unsigned long)(b->runs ? sum / b->runs : 0));
+        total_runs += b->runs;
+        total_missed += missed;
+    }
+
+    printf("\njitter distribution of all runs:\n");
+    for(uint8_t k = 0; k <= sizeof(bounds) / sizeof(bounds[0]); k++)
+    {
+        if(k == 0)
+            printf("  %12s", "0 us");
+        else if(k == sizeof(bounds) / sizeof(bounds[0]))
+            printf("  %5s%5lu us", "> ", (unsigned long)bounds[k - 1]);
+        else
+            printf("  %5lu-%4lu us", (unsigned long)bounds[k - 1] + 1U, (unsigned long)bounds[k]);
+        printf(" %7lu  %5.1f %%\n", (unsigned long)histogram[k],
+               total_runs ? 100.0 * histogram[k] / total_runs : 0.0);
+    }
+
+    Task_get_load(&load, false);
+    printf("\nruns %lu, missed activations %lu, events dropped %lu\n",
+           (unsigned long)total_runs, (unsigned long)total_missed,
+           (unsigned long)Task_events_dropped());
+    printf("load: tasks %u %%, asleep %u %%, idle loops %lu\n",
+           load.task_load, load.sleep, (unsigned long)load.idle_loops);
+    printf("tick interrupts taken: %lu of %lu ticks\n",
+           (unsigned long)sim_tick_irqs, (unsigned long)ticks);
+
+    printf("\nhost: Task_execute %.1f " BENCH_UNIT "/call, %lu calls\n",
+           host_calls ? (double)host_execute / host_calls : 0.0,
+           (unsigned long)host_calls);
+    printf("host: dispatch overhead %.1f " BENCH_UNIT "/run, %.1f " BENCH_UNIT "/ms\n",
+           host_dispatches ? (double)host_execute / host_dispatches : 0.0,
+           ticks ? (double)host_execute / ticks : 0.0);
+    printf("host: tick interrupt %.1f " BENCH_UNIT "/tick\n",
+           sim_tick_irqs ? (double)host_synch / sim_tick_irqs : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t ticks = 60000U;
+    uint32_t periodic = BENCH_PERIODIC_MAX;
+    bool plan = false;
+    Task_load load;
+    int opt;
+
+    while((opt = getopt(argc, argv, "t:n:p")) != -1)
+    {
+        switch(opt)
+        {
+            case 't':
+                ticks = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                periodic = (uint32_t)strtoul(optarg, NULL, 0);
+                if(periodic < 1U || periodic > BENCH_PERIODIC_MAX)
+                    periodic = BENCH_PERIODIC_MAX;
+                break;
+            case 'p':
+                plan = true;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-t ticks] [-n tasks] [-p]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    for(uint8_t i = 0; i < periodic; i++)
+    {
+        bench[bench_count].load = &bench_load[i];
+        bench[bench_count].task_idx = Task_create(0, bench_load[i].period_ms,
+                                                  bench_load[i].priority, bench_handler,
+                                                  (uintptr_t)&bench[bench_count]);
+        bench_count++;
+    }
+    bench_event = &bench[bench_count];
+    bench_event->load = &bench_load[BENCH_LOAD_COUNT - 1];
+    bench_event->task_idx = Task_create_event(bench_event->load->priority,
+                                              bench_handler, (uintptr_t)bench_event);
+    bench_count++;
+    for(uint8_t i = 0; i < bench_count; i++)
+    {
+        if(bench[i].task_idx == TASK_FULL)
+        {
+            fprintf(stderr, "MAX_TASKS is too small for %u tasks\n", bench_count);
+            return 2;
+        }
+    }
+
+    printf("sched_bench: %u periodic tasks + 1 event task every %u ticks, %lu ticks\n",
+           periodic, BENCH_EVENT_TICKS, (unsigned long)ticks);
+    printf("tickless idle %d, profiling %d, Task_plan %s\n", TASK_TICKLESS_IDLE,
+           TASK_PROFILING, plan ? "on" : "off");
+
+    if(plan)
+    {
+        sim_measuring = false;
+        bench_run(BENCH_PLAN_TICKS);
+        printf("Task_plan: worst busy window %lu us\n", (unsigned long)Task_plan());
+        sim_measuring = true;
+        bench_restart();
+    }
+    Task_get_load(&load, true);
+    sim_tick_irqs = 0;
+    host_synch = host_execute = 0;
+    host_calls = 0;
+    bench_run(ticks);
+
+    for(uint8_t i = 0; i < bench_count; i++) host_dispatches += bench[i].runs;
+    bench_report(ticks);
+    return 0;
+}
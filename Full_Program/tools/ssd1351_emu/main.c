@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  Draws the screens of the application through the SSD1351 emulator, saves
+ *  each one as a PPM and prints what it cost on the wire.
+ *
+ *  Build and run from this folder:
+ *
+ *  gcc -std=gnu99 -O2 -Wall -Werror -DOLED_SPI_HOST -I../../src -o ssd1351_emu main.c ssd1351_emu.c \
+ *      ../../src/OLED/oled*.c ../../src/hal/oled_spi_hal.c
+ *  ./ssd1351_emu [-o dir] [-g dir] [-f spi_hz]
+ *
+ *  or with make emu-check from the tools folder, which compares against the
+ *  snapshots in golden/.
+ *
+ *  -o dir      folder for the PPM snapshots, the current one by default
+ *  -g dir      compare each screen with the PPM of the same name in dir,
+ *              the exit code is 1 when one differs
+ *  -f spi_hz   SPI clock of the modelled time, 12 MHz by default
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ssd1351_emu.h"
+#include "OLED/oled.h"
+#include "OLED/oled_screen.h"
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+} emu_step;
+
+static void emu_init(void)
+{
+    OLEDC_initialize();
+}
+
+static void emu_logo(void)
+{
+    oledc_print_curiosity_logo();
+}
+
+static void emu_splash(void)
+{
+    oledc_screen_splash();
+}
+
+static void emu_fill(void)
+{
+    oledc_fill_screen(BLACK);
+}
+
+static void emu_line(void)
+{
+    oledc_draw_string_on_bg(2, 2, 1, 2, "  SAMD21 Demo  ", GREEN, BLACK);
+}
+
+// the sensor screen of the firmware, from oled_screen.c, with a chart of
+// 60 readings behind the last one
+static void emu_sensor_screen(void)
+{
+    uint8_t i;
+
+    oledc_screen_sensor();
+    for(i = 0; i < 59; i++)
+    {
+        oledc_screen_sensor_update(2340, 4100, 800 + (i % 20) * 4, false);
+    }
+    oledc_screen_sensor_update(2340, 4100, 812, false);
+}
+
+static void emu_new_reading(void)
+{
+    oledc_screen_sensor_update(2350, 4100, 813, false);
+}
+
+static void emu_co2_alarm(void)
+{
+    oledc_screen_sensor_update(2350, 4100, 1523, true);
+}
+
+static void emu_warning(void)
+{
+    oledc_show_warning("CO2 too high", "1523 ppm", "Open a window");
+}
+
+static const emu_step emu_steps[] = {
+    {"init",            emu_init},
+    {"logo",            emu_logo},
+    {"splash",          emu_splash},
+    {"fill",            emu_fill},
+    {"line",            emu_line},
+    {"sensor_screen",   emu_sensor_screen},
+    {"new_reading",     emu_new_reading},
+    {"co2_alarm",       emu_co2_alarm},
+    {"warning",         emu_warning},
+};
+
+int main(int argc, char **argv)
+{
+    const char *out = ".", *golden = NULL;
+    uint32_t spi_hz = 12000000;
+    ssd1351_emu_stats stats;
+    char path[256];
+    int opt, diff, failed = 0;
+    size_t i;
+
+    while((opt = getopt(argc, argv, "o:g:f:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'o': out = optarg;                         break;
+            case 'g': golden = optarg;                      break;
+            case 'f': spi_hz = strtoul(optarg, NULL, 0);    break;
+            default:
+                fprintf(stderr, "usage: %s [-o dir] [-g dir] [-f spi_hz]\n", argv[0]);
+                return 2;
+        }
+    }
+    if(spi_hz == 0)
+        spi_hz = 12000000;
+
+    ssd1351_emu_reset();
+    printf("%-14s %8s %8s %6s %7s %6s %10s\n",
+           "screen", "bytes", "data", "cmds", "windows", "frames", "wire us");
+    for(i = 0; i < sizeof(emu_steps) / sizeof(emu_steps[0]); i++)
+    {
+        emu_steps[i].draw();
+        oledc_wait();
+        ssd1351_emu_get_stats(&stats, true);
+        printf("%-14s %8u %8u %6u %7u %6u %10.1f\n", emu_steps[i].name, stats.bytes,
+               stats.data_bytes, stats.commands, stats.windows, stats.frames,
+               ssd1351_emu_wire_us(&stats, spi_hz));
+
+        snprintf(path, sizeof(path), "%s/%s.ppm", out, emu_steps[i].name);
+        if(!ssd1351_emu_write_ppm(path))
+            fprintf(stderr, "%s: cannot write\n", path);
+        if(golden)
+        {
+            snprintf(path, sizeof(path), "%s/%s.ppm", golden, emu_steps[i].name);
+            diff = ssd1351_emu_compare_ppm(path);
+            if(diff < 0)
+            {
+                printf("  %s: cannot read %s\n", emu_steps[i].name, path);
+                failed = 1;
+            }
+            else if(diff)
+            {
+                printf("  %s: %d pixels differ from %s\n", emu_steps[i].name, diff, path);
+                failed = 1;
+            }
+        }
+    }
+    printf("modelled at %lu Hz, wire time only\n", (unsigned long)spi_hz);
+    return failed;
+}
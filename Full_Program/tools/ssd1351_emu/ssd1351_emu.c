@@ -0,0 +1,320 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1351_emu.h"
+#include "OLED/oled.h"
+#include "hal/oled_spi_hal.h"
+
+// Remap OLEDC_initialize sets, the panel shows it upright
+#define SSD1351_EMU_PANEL_REMAP (SSD1351_RMP_COLOR_REV | SSD1351_RMP_SCAN_REV | SSD1351_RMP_SPLIT_ENABLE)
+
+#define SSD1351_EMU_REMAP_COL   0x02
+#define SSD1351_EMU_REMAP_SEQ   0x04
+
+typedef struct {
+    uint16_t ram[SSD1351_EMU_RAM_ROWS][SSD1351_EMU_RAM_COLS];
+    bool dc;
+    bool cs;
+    uint8_t command;
+    uint8_t args[2];
+    uint8_t argn;
+    bool high_byte;             // the first byte of a pixel is pending
+    uint8_t pixel_high;
+    uint8_t col_start, col_end, row_start, row_end;
+    uint8_t col, row;
+    uint8_t remap;
+    uint8_t start_line;
+    uint8_t offset;
+    uint8_t mux;
+    uint8_t mode;
+    bool sleep;
+    ssd1351_emu_stats stats;
+} ssd1351_emu_state;
+
+static ssd1351_emu_state emu;
+
+static uint8_t ssd1351_emu_args(uint8_t command)
+{
+    switch(command)
+    {
+        case SSD1351_SET_COL_ADDRESS:
+        case SSD1351_SET_ROW_ADDRESS:
+            return 2;
+        case SSD1351_SET_REMAP:
+        case SSD1351_SET_START_LINE:
+        case SSD1351_SET_OFFSET:
+        case SSD1351_MUX_RATIO:
+            return 1;
+        default:
+            // the other commands do not change the picture, their
+            // arguments are counted and dropped
+            return 0;
+    }
+}
+
+static void ssd1351_emu_command(uint8_t command)
+{
+    emu.command = command;
+    emu.argn = 0;
+    emu.stats.commands++;
+    switch(command)
+    {
+        case SSD1351_WRITE_RAM:
+            emu.col = emu.col_start;
+            emu.row = emu.row_start;
+            emu.high_byte = true;
+            break;
+        case SSD1351_SET_COL_ADDRESS:
+        case SSD1351_SET_ROW_ADDRESS:
+            emu.stats.windows++;
+            break;
+        case SSD1351_MODE_OFF:
+        case SSD1351_MODE_ON:
+        case SSD1351_MODE_NORMAL:
+        case SSD1351_MODE_INVERSE:
+            emu.mode = command;
+            break;
+        case SSD1351_SLEEP_ON:
+            emu.sleep = true;
+            break;
+        case SSD1351_SLEEP_OFF:
+            emu.sleep = false;
+            break;
+        default:
+            break;
+    }
+}
+
+static void ssd1351_emu_argument(uint8_t arg)
+{
+    if(emu.argn >= ssd1351_emu_args(emu.command))
+        return;
+    emu.args[emu.argn++] = arg;
+    if(emu.argn < ssd1351_emu_args(emu.command))
+        return;
+    switch(emu.command)
+    {
+        case SSD1351_SET_COL_ADDRESS:
+            emu.col_start = emu.args[0] & 0x7F;
+            emu.col_end = emu.args[1] & 0x7F;
+            break;
+        case SSD1351_SET_ROW_ADDRESS:
+            emu.row_start = emu.args[0] & 0x7F;
+            emu.row_end = emu.args[1] & 0x7F;
+            break;
+        case SSD1351_SET_REMAP:
+            emu.remap = emu.args[0];
+            break;
+        case SSD1351_SET_START_LINE:
+            emu.start_line = emu.args[0] & 0x7F;
+            break;
+        case SSD1351_SET_OFFSET:
+            emu.offset = emu.args[0] & 0x7F;
+            break;
+        case SSD1351_MUX_RATIO:
+            emu.mux = emu.args[0] & 0x7F;
+            break;
+        default:
+            break;
+    }
+}
+
+static void ssd1351_emu_data(uint8_t data)
+{
+    if(emu.high_byte)
+    {
+        emu.pixel_high = data;
+        emu.high_byte = false;
+        return;
+    }
+    emu.high_byte = true;
+    emu.ram[emu.row][emu.col] = (emu.pixel_high << 8) | data;
+    // the address moves on inside the window and wraps to its start
+    if(emu.remap & SSD1351_RMP_INC_VER)
+    {
+        if(emu.row++ == emu.row_end)
+        {
+            emu.row = emu.row_start;
+            emu.col = emu.col == emu.col_end ? emu.col_start : emu.col + 1;
+        }
+    }
+    else if(emu.col++ == emu.col_end)
+    {
+        emu.col = emu.col_start;
+        emu.row = emu.row == emu.row_end ? emu.row_start : emu.row + 1;
+    }
+}
+
+/* ----------------------------------------------------------- HAL HOST HOOKS */
+void OLED_spi_host_dc(bool high)
+{
+    if(high != emu.dc)
+        emu.stats.dc_changes++;
+    emu.dc = high;
+}
+
+void OLED_spi_host_cs(bool high)
+{
+    if(!high && emu.cs)
+        emu.stats.frames++;
+    emu.cs = high;
+}
+
+void OLED_spi_host_write(const uint8_t *data, size_t len)
+{
+    while(len--)
+    {
+        emu.stats.bytes++;
+        if(emu.cs)
+        {
+            // not selected, the controller does not see it
+            data++;
+            continue;
+        }
+        if(!emu.dc)
+        {
+            ssd1351_emu_command(*data++);
+        }
+        else if(emu.command == SSD1351_WRITE_RAM)
+        {
+            emu.stats.data_bytes++;
+            ssd1351_emu_data(*data++);
+        }
+        else
+        {
+            ssd1351_emu_argument(*data++);
+        }
+    }
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+void ssd1351_emu_reset(void)
+{
+    memset(&emu, 0, sizeof(emu));
+    emu.cs = true;
+    emu.col_end = SSD1351_EMU_RAM_COLS - 1;
+    emu.row_end = SSD1351_EMU_RAM_ROWS - 1;
+    emu.remap = SSD1351_EMU_PANEL_REMAP;
+    emu.offset = SSD1351_DEFAULT_OFFSET;
+    emu.mux = SSD1351_EMU_RAM_ROWS - 1;
+    emu.mode = SSD1351_MODE_NORMAL;
+    emu.sleep = true;
+}
+
+void ssd1351_emu_get_stats(ssd1351_emu_stats *stats, bool reset)
+{
+    *stats = emu.stats;
+    if(reset)
+        memset(&emu.stats, 0, sizeof(emu.stats));
+}
+
+double ssd1351_emu_wire_us(const ssd1351_emu_stats *stats, uint32_t spi_hz)
+{
+    return stats->bytes * 8.0 * 1e6 / spi_hz;
+}
+
+uint16_t ssd1351_emu_pixel(uint8_t x, uint8_t y)
+{
+    uint8_t changed = emu.remap ^ SSD1351_EMU_PANEL_REMAP;
+    uint16_t color;
+
+    if(x >= SSD1351_SCREEN_WIDTH || y >= SSD1351_SCREEN_HEIGHT || emu.sleep || y > emu.mux)
+        return 0;
+    if(emu.mode == SSD1351_MODE_OFF)
+        return 0;
+    if(emu.mode == SSD1351_MODE_ON)
+        return 0xFFFF;
+    if(changed & SSD1351_RMP_SCAN_REV)
+        y = emu.mux - y;
+    if(changed & SSD1351_EMU_REMAP_COL)
+        x = SSD1351_SCREEN_WIDTH - 1 - x;
+    color = emu.ram[(emu.start_line + y + emu.offset + SSD1351_EMU_RAM_ROWS - SSD1351_DEFAULT_OFFSET) % SSD1351_EMU_RAM_ROWS]
+                   [SSD1351_COL_OFF + x];
+    if(changed & SSD1351_EMU_REMAP_SEQ)
+        color = (color & 0x07E0) | (color >> 11) | ((color & 0x001F) << 11);
+    return emu.mode == SSD1351_MODE_INVERSE ? ~color : color;
+}
+
+uint16_t ssd1351_emu_ram(uint8_t column, uint8_t row)
+{
+    return emu.ram[row % SSD1351_EMU_RAM_ROWS][column % SSD1351_EMU_RAM_COLS];
+}
+
+bool ssd1351_emu_write_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint16_t c;
+    uint8_t x, y;
+
+    if(f == NULL)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", SSD1351_SCREEN_WIDTH, SSD1351_SCREEN_HEIGHT);
+    for(y = 0; y < SSD1351_SCREEN_HEIGHT; y++)
+    {
+        for(x = 0; x < SSD1351_SCREEN_WIDTH; x++)
+        {
+            // 5 and 6 bits widened so that white stays 255
+            c = ssd1351_emu_pixel(x, y);
+            fputc(((c >> 11) << 3) | (c >> 13), f);
+            fputc((((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x03), f);
+            fputc(((c & 0x1F) << 3) | ((c >> 2) & 0x07), f);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+int ssd1351_emu_compare_ppm(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    int width, height, max, diff = 0;
+    uint8_t rgb[3];
+    uint16_t c;
+    uint8_t x, y;
+
+    if(f == NULL)
+        return -1;
+    if(fscanf(f, "P6 %d %d %d", &width, &height, &max) != 3 || fgetc(f) == EOF ||
+       width != SSD1351_SCREEN_WIDTH || height != SSD1351_SCREEN_HEIGHT || max != 255)
+    {
+        fclose(f);
+        return -1;
+    }
+    for(y = 0; y < SSD1351_SCREEN_HEIGHT; y++)
+    {
+        for(x = 0; x < SSD1351_SCREEN_WIDTH; x++)
+        {
+            if(fread(rgb, 1, 3, f) != 3)
+            {
+                fclose(f);
+                return -1;
+            }
+            c = ssd1351_emu_pixel(x, y);
+            diff += (rgb[0] >> 3) != (c >> 11) || (rgb[1] >> 2) != ((c >> 5) & 0x3F) ||
+                    (rgb[2] >> 3) != (c & 0x1F);
+        }
+    }
+    fclose(f);
+    return diff;
+}
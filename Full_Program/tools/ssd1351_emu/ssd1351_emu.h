@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright (C) 2023-2024 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ *  SSD1351 emulator for host builds
+ *
+ *  Built with OLED_SPI_HOST, oled_spi_hal.c hands every byte it would send
+ *  to OLED_spi_host_write, with D/C and CS through OLED_spi_host_dc and
+ *  OLED_spi_host_cs. The emulator implements these hooks: it decodes the
+ *  SSD1351 commands into a 128 x 128 GDDRAM, shows it through the remap,
+ *  start line, offset, MUX ratio and display mode registers, and counts what
+ *  goes over the wire.
+ *
+ *  The panel of the board is modelled: the registers OLEDC_initialize sets
+ *  give an upright picture, with the 96 columns from SSD1351_COL_OFF on. A
+ *  remap, offset or start line that differs from them mirrors or moves the
+ *  picture as on the hardware.
+ */
+
+#ifndef SSD1351_EMU_H
+#define	SSD1351_EMU_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SSD1351_EMU_RAM_ROWS    128
+#define SSD1351_EMU_RAM_COLS    128
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint32_t bytes;             // all bytes on the wire
+    uint32_t data_bytes;        // bytes written to the GDDRAM
+    uint32_t commands;
+    uint32_t windows;           // column or row address commands
+    uint32_t frames;            // CS low periods
+    uint32_t dc_changes;
+} ssd1351_emu_stats;
+
+/*!
+ *  @brief This API sets the emulator to its power-on state, the counters
+ *  are cleared.
+ */
+void ssd1351_emu_reset(void);
+
+/*!
+ *  @brief This API returns the counters.
+ *
+ *  @param[out] *stats : The counters
+ *  @param[in] reset : Clear them afterwards
+ */
+void ssd1351_emu_get_stats(ssd1351_emu_stats *stats, bool reset);
+
+/*!
+ *  @brief This API returns the time the bytes of the counters take on the
+ *  wire at a SPI clock, the gaps between transfers are not modelled.
+ *
+ *  @param[in] *stats : The counters
+ *  @param[in] spi_hz : SPI clock
+ *
+ *  @return The time in microseconds
+ */
+double ssd1351_emu_wire_us(const ssd1351_emu_stats *stats, uint32_t spi_hz);
+
+/*!
+ *  @brief This API returns a pixel as the panel shows it.
+ *
+ *  @param[in] x : Column of the panel, 0 to 95
+ *  @param[in] y : Line of the panel, 0 to 95
+ *
+ *  @return The color, RGB565
+ */
+uint16_t ssd1351_emu_pixel(uint8_t x, uint8_t y);
+
+/*!
+ *  @brief This API returns a pixel of the GDDRAM.
+ *
+ *  @param[in] column : Column, 0 to 127
+ *  @param[in] row : Row, 0 to 127
+ *
+ *  @return The color, RGB565 as written
+ */
+uint16_t ssd1351_emu_ram(uint8_t column, uint8_t row);
+
+/*!
+ *  @brief This API writes what the panel shows to a binary PPM file.
+ *
+ *  @param[in] *path : Name of the file
+ *
+ *  @return false when the file cannot be written
+ */
+bool ssd1351_emu_write_ppm(const char *path);
+
+/*!
+ *  @brief This API compares what the panel shows with a PPM file written
+ *  by ssd1351_emu_write_ppm.
+ *
+ *  @param[in] *path : Name of the file
+ *
+ *  @return The number of pixels that differ, -1 when the file cannot be read
+ */
+int ssd1351_emu_compare_ppm(const char *path);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* SSD1351_EMU_H */